@@ -344,62 +344,53 @@ bool QuickTimeAudioDecoder::QuickTimeAudioTrack::isOldDemuxing() const {
 
 AudioStream *QuickTimeAudioDecoder::QuickTimeAudioTrack::readAudioChunk(uint chunk) {
 	AudioSampleDesc *entry = (AudioSampleDesc *)_parentTrack->sampleDescs[0];
-	Common::MemoryWriteStreamDynamic *wStream = new Common::MemoryWriteStreamDynamic(DisposeAfterUse::NO);
-
-	_decoder->_fd->seek(_parentTrack->chunkOffsets[chunk]);
 
 	// First, we have to get the sample count
 	uint32 sampleCount = getAudioChunkSampleCount(chunk);
 	assert(sampleCount != 0);
 
+	// The samples of a chunk are stored back to back, so only the total size
+	// is needed to read all of them at once
+	uint32 size = 0;
+
 	if (isOldDemuxing()) {
 		// Old-style audio demuxing
 
 		// Then calculate the right sizes
 		while (sampleCount > 0) {
-			uint32 samples = 0, size = 0;
+			uint32 samples = 0;
 
 			if (entry->_samplesPerFrame >= 160) {
 				samples = entry->_samplesPerFrame;
-				size = entry->_bytesPerFrame;
+				size += entry->_bytesPerFrame;
 			} else if (entry->_samplesPerFrame > 1) {
 				samples = MIN<uint32>((1024 / entry->_samplesPerFrame) * entry->_samplesPerFrame, sampleCount);
-				size = (samples / entry->_samplesPerFrame) * entry->_bytesPerFrame;
+				size += (samples / entry->_samplesPerFrame) * entry->_bytesPerFrame;
 			} else {
 				samples = MIN<uint32>(1024, sampleCount);
-				size = samples * _parentTrack->sampleSize;
+				size += samples * _parentTrack->sampleSize;
 			}
 
-			// Now, we read in the data for this data and output it
-			byte *data = (byte *)malloc(size);
-			_decoder->_fd->read(data, size);
-			wStream->write(data, size);
-			free(data);
 			sampleCount -= samples;
 		}
 	} else {
 		// New-style audio demuxing
 
 		// Find our starting sample
-		uint32 startSample = 0;
-		for (uint32 i = 0; i < chunk; i++)
-			startSample += getAudioChunkSampleCount(i);
-
-		for (uint32 i = 0; i < sampleCount; i++) {
-			uint32 size = (_parentTrack->sampleSize != 0) ? _parentTrack->sampleSize : _parentTrack->sampleSizes[i + startSample];
-
-			// Now, we read in the data for this data and output it
-			byte *data = (byte *)malloc(size);
-			_decoder->_fd->read(data, size);
-			wStream->write(data, size);
-			free(data);
-		}
+		uint32 startSample = _parentTrack->chunkFirstSamples[chunk];
+
+		for (uint32 i = 0; i < sampleCount; i++)
+			size += _parentTrack->getSampleSize(i + startSample);
 	}
 
-	AudioStream *audioStream = entry->createAudioStream(new Common::MemoryReadStream(wStream->getData(), wStream->size(), DisposeAfterUse::YES));
-	delete wStream;
+	// Now, we read in the data for this chunk and output it
+	_decoder->_fd->seek(_parentTrack->chunkOffsets[chunk]);
+	byte *data = (byte *)malloc(size);
+	uint32 readSize = _decoder->_fd->read(data, size);
+	if (readSize < size)
+		memset(data + readSize, 0, size - readSize);
 
-	return audioStream;
+	return entry->createAudioStream(new Common::MemoryReadStream(data, size, DisposeAfterUse::YES));
 }
 
 void QuickTimeAudioDecoder::QuickTimeAudioTrack::skipSamples(const Timestamp &length, AudioStream *stream) {
@@ -525,13 +516,7 @@ void QuickTimeAudioDecoder::QuickTimeAudioTrack::queueStream(AudioStream *stream
 }
 
 uint32 QuickTimeAudioDecoder::QuickTimeAudioTrack::getAudioChunkSampleCount(uint chunk) const {
-	uint32 sampleCount = 0;
-
-	for (uint32 i = 0; i < _parentTrack->sampleToChunkCount; i++)
-		if (chunk >= _parentTrack->sampleToChunk[i].first)
-			sampleCount = _parentTrack->sampleToChunk[i].count;
-
-	return sampleCount;
+	return _parentTrack->getChunkSampleCount(chunk);
 }
 
 Timestamp QuickTimeAudioDecoder::QuickTimeAudioTrack::getChunkLength(uint chunk, bool skipAACPrimer) const {
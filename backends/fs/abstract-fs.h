@@ -183,6 +183,15 @@ public:
 	 */
 	virtual Common::SeekableReadStream *createReadStream() = 0;
 
+	/**
+	 * Creates a MemoryReadStream instance backed by a memory mapping of the
+	 * file referred by this node. Backends without support for memory
+	 * mapped files do not need to implement this.
+	 *
+	 * @return pointer to the stream object, 0 in case of a failure
+	 */
+	virtual Common::MemoryReadStream *createMappedReadStream() { return 0; }
+
 	/**
 	 * Creates a WriteStream instance corresponding to the file
 	 * referred by this node. This assumes that the node actually refers
@@ -28,9 +28,13 @@
 #include "backends/fs/posix/posix-fs.h"
 #include "backends/fs/stdiostream.h"
 #include "common/algorithm.h"
+#include "common/memstream.h"
 
 #include <sys/param.h>
 #include <sys/stat.h>
+#ifdef HAVE_MMAP
+#include <sys/mman.h>
+#endif
 #ifdef PSP2
 #include "backends/fs/psp2/psp2-dirent.h"
 #define mkdir sceIoMkdir
@@ -249,6 +253,53 @@ Common::SeekableReadStream *POSIXFilesystemNode::createReadStream() {
 	return StdioStream::makeFromPath(getPath(), false);
 }
 
+#ifdef HAVE_MMAP
+/**
+ * A read stream over a private memory mapping of a file. The mapping is
+ * writable so that callers which patch data in place after reading it do not
+ * fault, but such changes are copy-on-write and never reach the file.
+ */
+class POSIXMappedReadStream : public Common::MemoryReadStream {
+public:
+	POSIXMappedReadStream(void *mapping, uint32 size) :
+		Common::MemoryReadStream((const byte *)mapping, size), _mapping(mapping), _mappingSize(size) {}
+
+	virtual ~POSIXMappedReadStream() {
+		munmap(_mapping, _mappingSize);
+	}
+
+private:
+	void *_mapping;
+	uint32 _mappingSize;
+};
+#endif
+
+Common::MemoryReadStream *POSIXFilesystemNode::createMappedReadStream() {
+#ifdef HAVE_MMAP
+	const int fd = open(_path.c_str(), O_RDONLY);
+	if (fd == -1)
+		return 0;
+
+	struct stat st;
+	void *mapping = MAP_FAILED;
+	// Empty files cannot be mapped, and files of 2 GiB or more do not fit in
+	// the 32-bit size of a stream
+	if (fstat(fd, &st) == 0 && S_ISREG(st.st_mode) && st.st_size > 0 && st.st_size <= 0x7FFFFFFF)
+		mapping = mmap(0, st.st_size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+
+	// The mapping keeps its own reference to the file, so the descriptor is
+	// not needed any more
+	close(fd);
+
+	if (mapping == MAP_FAILED)
+		return 0;
+
+	return new POSIXMappedReadStream(mapping, st.st_size);
+#else
+	return 0;
+#endif
+}
+
 Common::WriteStream *POSIXFilesystemNode::createWriteStream() {
 	return StdioStream::makeFromPath(getPath(), true);
 }
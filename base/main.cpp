@@ -62,6 +62,7 @@
 #include "graphics/cursorman.h"
 #include "graphics/fontman.h"
 #include "graphics/yuv_to_rgb.h"
+#include "image/codecs/codec.h"
 #ifdef USE_FREETYPE2
 #include "graphics/fonts/ttf.h"
 #endif
@@ -635,6 +636,7 @@ extern "C" int scummvm_main(int argc, const char * const argv[]) {
 #endif
 	EngineManager::destroy();
 	Graphics::YUVToRGBManager::destroy();
+	Image::QuickTimeDitherTableManager::destroy();
 
 	return 0;
 }
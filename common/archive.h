@@ -31,6 +31,7 @@
 namespace Common {
 
 class FSNode;
+class MemoryReadStream;
 class SeekableReadStream;
 
 
@@ -46,6 +47,16 @@ class ArchiveMember {
 public:
 	virtual ~ArchiveMember() { }
 	virtual SeekableReadStream *createReadStream() const = 0;
+
+	/**
+	 * Creates a stream which reads the member directly from memory mapped
+	 * into the address space of the process, if the member and the platform
+	 * support it.
+	 *
+	 * @return pointer to the stream object, 0 if the member cannot be mapped
+	 */
+	virtual MemoryReadStream *createMappedReadStream() const { return 0; }
+
 	virtual String getName() const = 0;
 	virtual String getDisplayName() const { return getName(); }
 };
@@ -134,6 +134,26 @@ private:
 		return b;
 	}
 
+	/**
+	 * Take the next count bits, at most valueBits, out of the current value.
+	 * The bits are returned in their natural order, right-aligned.
+	 */
+	inline uint32 getBits_internal(int count) {
+		uint32 b;
+		if (count == 32) {
+			b = _value;
+			_value = 0;
+		} else if (isMSB2LSB) {
+			b = _value >> (32 - count);
+			_value <<= count;
+		} else {
+			b = _value & ((1u << count) - 1);
+			_value >>= count;
+		}
+
+		return b;
+	}
+
 public:
 	/** Read a bit from the bit stream. */
 	uint32 getBit() {
@@ -167,45 +187,33 @@ public:
 		if (n > 32)
 			error("BitStreamImpl::getBits(): Too many bits requested to be read");
 
-		// Read the number of bits
+		// Read the number of bits, taking as many as possible at once out of
+		// each data value
 		uint32 v = 0;
+		int shift = 0;
 
 		uint8 nOrig = n;
-		if (_inValue) {
-			int count = MIN((int)n, valueBits - _inValue);
-			for (int i = 0; i < count; ++i) {
-				if (isMSB2LSB) {
-					v = (v << 1) | getBit_internal();
-				} else {
-					v = (v >> 1) | (getBit_internal() << 31);
-				}
-			}
-
-			n -= count;
-		}
-
 		while (n > 0) {
-			// NB: readValue doesn't care that _inValue is incorrect here
-			readValue();
+			if (_inValue == 0) {
+				// NB: readValue doesn't care that _inValue is incorrect here
+				readValue();
+			}
 
-			int count = MIN((int)n, valueBits);
-			for (int i = 0; i < count; ++i) {
-				if (isMSB2LSB) {
-					v = (v << 1) | getBit_internal();
-				} else {
-					v = (v >> 1) | (getBit_internal() << 31);
-				}
+			int count = MIN((int)n, valueBits - _inValue);
+			uint32 b = getBits_internal(count);
+			if (isMSB2LSB) {
+				v = (count == 32) ? b : ((v << count) | b);
+			} else {
+				v |= b << shift;
+				shift += count;
 			}
 
+			_inValue = (_inValue + count) % valueBits;
 			n -= count;
 		}
 
-		_inValue = (_inValue + nOrig) % valueBits;
 		_pos += nOrig;
 
-		if (!isMSB2LSB)
-			v >>= (32 - nOrig);
-
 		return v;
 	}
 
@@ -279,8 +287,12 @@ public:
 
 	/** Skip the specified amount of bits. */
 	void skip(uint32 n) {
-		while (n-- > 0)
-			getBit();
+		while (n > 32) {
+			getBits(32);
+			n -= 32;
+		}
+
+		getBits(n);
 	}
 
 	/** Skip the bits to closest data value border. */
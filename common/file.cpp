@@ -24,6 +24,7 @@
 #include "common/debug.h"
 #include "common/file.h"
 #include "common/fs.h"
+#include "common/memstream.h"
 #include "common/textconsole.h"
 #include "common/system.h"
 #include "backends/fs/fs-factory.h"
@@ -31,7 +32,7 @@
 namespace Common {
 
 File::File()
-	: _handle(0) {
+	: _handle(0), _mappedData(0) {
 }
 
 File::~File() {
@@ -87,6 +88,20 @@ bool File::open(SeekableReadStream *stream, const String &name) {
 }
 
 
+bool File::openMapped(const String &filename) {
+	assert(!filename.empty());
+	assert(!_handle);
+
+	ArchiveMemberPtr member = SearchMan.getMember(filename);
+	MemoryReadStream *stream = member ? member->createMappedReadStream() : 0;
+	if (!stream)
+		return open(filename);
+
+	debug(8, "Opening mapped: %s", filename.c_str());
+	_mappedData = stream->getData();
+	return open(stream, filename);
+}
+
 bool File::exists(const String &filename) {
 	if (SearchMan.hasFile(filename)) {
 		return true;
@@ -102,6 +117,7 @@ bool File::exists(const String &filename) {
 void File::close() {
 	delete _handle;
 	_handle = NULL;
+	_mappedData = 0;
 }
 
 bool File::isOpen() const {
@@ -44,6 +44,9 @@ protected:
 	/** The name of this file, kept for debugging purposes. */
 	String _name;
 
+	/** The contents of the file if it was opened with openMapped; 0 otherwise. */
+	const byte *_mappedData;
+
 public:
 	File();
 	virtual ~File();
@@ -98,6 +101,26 @@ public:
 	 */
 	virtual bool open(SeekableReadStream *stream, const String &name);
 
+	/**
+	 * Try to open the file with the given filename, by searching SearchMan,
+	 * as a memory mapped file. If the file cannot be memory mapped, it is
+	 * opened like open(const String &) does instead.
+	 * @note Must not be called if this file already is open (i.e. if isOpen returns true).
+	 *
+	 * @param	filename	the name of the file to open
+	 * @return	true if file was opened successfully, false otherwise
+	 */
+	bool openMapped(const String &filename);
+
+	/**
+	 * Returns a read-only pointer to the entire contents of the file, if it
+	 * was memory mapped by openMapped. The pointer remains valid until the
+	 * file is closed.
+	 *
+	 * @return pointer to the file contents, 0 if the file is not memory mapped
+	 */
+	const byte *getMappedData() const { return _mappedData; }
+
 	/**
 	 * Close the file, if open.
 	 */
@@ -140,6 +140,13 @@ SeekableReadStream *FSNode::createReadStream() const {
 	return _realNode->createReadStream();
 }
 
+MemoryReadStream *FSNode::createMappedReadStream() const {
+	if (_realNode == 0 || !_realNode->exists() || _realNode->isDirectory())
+		return 0;
+
+	return _realNode->createMappedReadStream();
+}
+
 WriteStream *FSNode::createWriteStream() const {
 	if (_realNode == 0)
 		return 0;
@@ -35,6 +35,7 @@ class AbstractFSNode;
 namespace Common {
 
 class FSNode;
+class MemoryReadStream;
 class SeekableReadStream;
 class WriteStream;
 
@@ -222,6 +223,19 @@ public:
 	 */
 	virtual SeekableReadStream *createReadStream() const;
 
+	/**
+	 * Creates a MemoryReadStream instance backed by a read-only memory
+	 * mapping of the file referred by this node. Pages of the mapping are
+	 * loaded on demand and shared with the operating system file cache.
+	 * This assumes that the node actually refers to a readable file, and
+	 * that the backend supports memory mapped files. If this is not the
+	 * case, 0 is returned, and callers should fall back to
+	 * createReadStream().
+	 *
+	 * @return pointer to the stream object, 0 in case of a failure
+	 */
+	virtual MemoryReadStream *createMappedReadStream() const;
+
 	/**
 	 * Creates a WriteStream instance corresponding to the file
 	 * referred by this node. This assumes that the node actually refers
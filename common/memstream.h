@@ -71,6 +71,12 @@ public:
 	int32 size() const { return _size; }
 
 	bool seek(int32 offs, int whence = SEEK_SET);
+
+	/**
+	 * Returns a read-only pointer to the start of the wrapped memory buffer.
+	 * The pointer remains valid for the lifetime of the stream.
+	 */
+	const byte *getData() const { return _ptrOrig; }
 };
 
 
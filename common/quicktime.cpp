@@ -131,8 +131,61 @@ void QuickTimeParser::init() {
 				_tracks[i]->editList[0].mediaTime = 0;
 				_tracks[i]->editList[0].mediaRate = 1;
 			}
+
+			_tracks[i]->buildSampleIndex();
+		}
+	}
+}
+
+SeekableReadStream *QuickTimeParser::readSample(Track *track, uint32 sample, uint32 &descId) {
+	int32 chunk = track->findSampleChunk(sample);
+	if (chunk < 0)
+		return 0;
+
+	descId = track->getChunkDescId(chunk);
+
+	uint32 offset = track->getSampleOffset(sample, chunk);
+	uint32 size = track->getSampleSize(sample);
+
+	if (offset < track->readAheadOffset || offset + size > track->readAheadOffset + track->readAheadSize) {
+		if (size > kReadAheadSize) {
+			_fd->seek(offset);
+			return _fd->readStream(size);
+		}
+
+		// Extend the read over the following samples of the track for as
+		// long as they fit into the buffer, even if other data sits between
+		// them, so that interleaved movies are still read in large blocks
+		uint32 end = offset + size;
+		uint32 nextChunk = chunk;
+		for (uint32 i = sample + 1; i < track->chunkFirstSamples[track->chunkCount]; i++) {
+			while (i >= track->chunkFirstSamples[nextChunk + 1])
+				nextChunk++;
+
+			uint32 nextOffset = track->getSampleOffset(i, nextChunk);
+			uint32 nextEnd = nextOffset + track->getSampleSize(i);
+			if (nextOffset < end || nextEnd - offset > kReadAheadSize)
+				break;
+
+			end = nextEnd;
+		}
+
+		if (!track->readAheadBuffer)
+			track->readAheadBuffer = (byte *)malloc(kReadAheadSize);
+
+		_fd->seek(offset);
+		track->readAheadOffset = offset;
+		track->readAheadSize = _fd->read(track->readAheadBuffer, end - offset);
+
+		if (track->readAheadSize < size) {
+			_fd->seek(offset);
+			return _fd->readStream(size);
 		}
 	}
+
+	byte *data = (byte *)malloc(size);
+	memcpy(data, track->readAheadBuffer + offset - track->readAheadOffset, size);
+	return new MemoryReadStream(data, size, DisposeAfterUse::YES);
 }
 
 void QuickTimeParser::initParseTable() {
@@ -839,6 +892,11 @@ QuickTimeParser::Track::Track() {
 	duration = 0;
 	startTime = 0;
 	mediaDuration = 0;
+	chunkFirstSamples = 0;
+	sampleOffsets = 0;
+	readAheadBuffer = 0;
+	readAheadOffset = 0;
+	readAheadSize = 0;
 }
 
 QuickTimeParser::Track::~Track() {
@@ -847,9 +905,91 @@ QuickTimeParser::Track::~Track() {
 	delete[] sampleToChunk;
 	delete[] sampleSizes;
 	delete[] keyframes;
+	delete[] chunkFirstSamples;
+	delete[] sampleOffsets;
+	free(readAheadBuffer);
 
 	for (uint32 i = 0; i < sampleDescs.size(); i++)
 		delete sampleDescs[i];
 }
 
+void QuickTimeParser::Track::buildSampleIndex() {
+	// Decoders initialize the parser again after loading a file
+	delete[] chunkFirstSamples;
+	delete[] sampleOffsets;
+	sampleOffsets = 0;
+
+	chunkFirstSamples = new uint32[chunkCount + 1];
+
+	uint32 sampleToChunkIndex = 0;
+	uint32 samplesPerChunk = 0;
+	uint32 totalSampleCount = 0;
+	for (uint32 i = 0; i < chunkCount; i++) {
+		while (sampleToChunkIndex < sampleToChunkCount && i >= sampleToChunk[sampleToChunkIndex].first)
+			samplesPerChunk = sampleToChunk[sampleToChunkIndex++].count;
+
+		chunkFirstSamples[i] = totalSampleCount;
+		totalSampleCount += samplesPerChunk;
+	}
+
+	chunkFirstSamples[chunkCount] = totalSampleCount;
+
+	if (sampleSize != 0 || !sampleSizes)
+		return;
+
+	// Chunks may claim more samples than the size table holds
+	if (totalSampleCount > sampleCount) {
+		warning("QuickTimeParser: Chunks contain %d samples, but only %d sample sizes exist", totalSampleCount, sampleCount);
+		chunkFirstSamples[chunkCount] = sampleCount;
+		for (uint32 i = 0; i < chunkCount; i++)
+			chunkFirstSamples[i] = MIN(chunkFirstSamples[i], sampleCount);
+	}
+
+	sampleOffsets = new uint32[sampleCount];
+	memset(sampleOffsets, 0, sampleCount * sizeof(uint32));
+	for (uint32 i = 0; i < chunkCount; i++) {
+		uint32 offset = chunkOffsets[i];
+		for (uint32 j = chunkFirstSamples[i]; j < chunkFirstSamples[i + 1]; j++) {
+			sampleOffsets[j] = offset;
+			offset += sampleSizes[j];
+		}
+	}
+}
+
+int32 QuickTimeParser::Track::findSampleChunk(uint32 sample) const {
+	if (!chunkFirstSamples || sample >= chunkFirstSamples[chunkCount])
+		return -1;
+
+	// Find the last chunk starting at or before the sample; empty chunks
+	// share their first sample with the chunk after them
+	uint32 low = 0;
+	uint32 high = chunkCount;
+	while (high - low > 1) {
+		uint32 mid = (low + high) / 2;
+		if (chunkFirstSamples[mid] <= sample)
+			low = mid;
+		else
+			high = mid;
+	}
+
+	return low;
+}
+
+uint32 QuickTimeParser::Track::getChunkDescId(uint32 chunk) const {
+	if (sampleToChunkCount == 0 || chunk < sampleToChunk[0].first)
+		return 0;
+
+	uint32 low = 0;
+	uint32 high = sampleToChunkCount;
+	while (high - low > 1) {
+		uint32 mid = (low + high) / 2;
+		if (sampleToChunk[mid].first <= chunk)
+			low = mid;
+		else
+			high = mid;
+	}
+
+	return sampleToChunk[low].id;
+}
+
 } // End of namespace Video
@@ -158,6 +158,53 @@ protected:
 		uint32 startTime;
 		Rational scaleFactorX;
 		Rational scaleFactorY;
+
+		/**
+		 * The index of the first sample of every chunk, plus the total number
+		 * of samples in all chunks as the last entry.
+		 */
+		uint32 *chunkFirstSamples;
+
+		/**
+		 * The file offset of every sample, only used when samples have
+		 * different sizes.
+		 */
+		uint32 *sampleOffsets;
+
+		/** Buffered file data following the last sample read. */
+		byte *readAheadBuffer;
+		uint32 readAheadOffset;
+		uint32 readAheadSize;
+
+		/** Build the chunk and sample index from the sample tables. */
+		void buildSampleIndex();
+
+		/**
+		 * Returns the chunk holding the given sample, or -1 if there is no
+		 * such sample.
+		 */
+		int32 findSampleChunk(uint32 sample) const;
+
+		/** Returns the number of samples in the given chunk. */
+		uint32 getChunkSampleCount(uint32 chunk) const {
+			return chunkFirstSamples[chunk + 1] - chunkFirstSamples[chunk];
+		}
+
+		/** Returns the sample description ID used by the given chunk. */
+		uint32 getChunkDescId(uint32 chunk) const;
+
+		/** Returns the file offset of a sample in the given chunk. */
+		uint32 getSampleOffset(uint32 sample, uint32 chunk) const {
+			if (sampleSize != 0)
+				return chunkOffsets[chunk] + (sample - chunkFirstSamples[chunk]) * sampleSize;
+
+			return sampleOffsets[sample];
+		}
+
+		/** Returns the size of the given sample. */
+		uint32 getSampleSize(uint32 sample) const {
+			return (sampleSize != 0) ? sampleSize : sampleSizes[sample];
+		}
 	};
 
 	virtual SampleDesc *readSampleDesc(Track *track, uint32 format, uint32 descSize) = 0;
@@ -170,7 +217,25 @@ protected:
 
 	void init();
 
+	/**
+	 * Read the data of a sample of the given track. Samples of the track that
+	 * follow it closely in the file are read in the same I/O operation and
+	 * kept in the read-ahead buffer of the track, so reading a track in
+	 * order rarely needs to seek.
+	 *
+	 * @param track   the track to read from
+	 * @param sample  the sample to read
+	 * @param descId  set to the sample description ID of the sample
+	 * @return the sample data, or 0 if the sample does not exist
+	 */
+	SeekableReadStream *readSample(Track *track, uint32 sample, uint32 &descId);
+
 private:
+	enum {
+		/** The maximum amount of data to read ahead per track. */
+		kReadAheadSize = 64 * 1024
+	};
+
 	struct Atom {
 		uint32 type;
 		uint32 offset;
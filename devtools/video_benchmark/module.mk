@@ -0,0 +1,26 @@
+
+# The tool uses dirent, stat and fork, so it is only built on POSIX hosts
+ifdef POSIX
+
+MODULE := devtools/video_benchmark
+
+MODULE_OBJS := \
+	video_benchmark.o
+
+# Set the name of the executable
+TOOL_EXECUTABLE := video_benchmark
+
+# The decoders are taken from the regular ScummVM libraries
+TOOL_DEPS := \
+	video/libvideo.a \
+	image/libimage.a \
+	audio/libaudio.a \
+	graphics/libgraphics.a \
+	common/libcommon.a
+
+TOOL_LIBS := $(LIBS)
+
+# Include common rules
+include $(srcdir)/rules.mk
+
+endif
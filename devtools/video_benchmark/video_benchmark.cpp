@@ -0,0 +1,539 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+
+// Measures how fast the video decoders decode a directory of sample files.
+//
+// Every file is decoded once for each output format in its own process, so
+// that the peak memory use of each decoder can be measured and a crashing
+// decoder does not end the run. This uses POSIX APIs and only builds on
+// POSIX hosts.
+
+// Disable symbol overrides so that we can use system headers.
+#define FORBIDDEN_SYMBOL_ALLOW_ALL
+
+#include <dirent.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <sys/resource.h>
+#include <sys/time.h>
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include "common/scummsys.h"
+#include "common/algorithm.h"
+#include "common/array.h"
+#include "common/str.h"
+#include "common/stream.h"
+#include "common/system.h"
+#include "common/textconsole.h"
+
+#include "audio/mixer_intern.h"
+
+#include "graphics/pixelformat.h"
+#include "graphics/surface.h"
+
+#include "video/avi_decoder.h"
+#include "video/bink_decoder.h"
+#include "video/coktel_decoder.h"
+#include "video/dxa_decoder.h"
+#include "video/flic_decoder.h"
+#include "video/mpegps_decoder.h"
+#include "video/psx_decoder.h"
+#include "video/qt_decoder.h"
+#include "video/smk_decoder.h"
+#include "video/theora_decoder.h"
+
+namespace {
+
+/**
+ * The bare minimum of a backend needed by the decoders: a screen format, a
+ * mixer which never plays anything, a clock and log output.
+ */
+class BenchmarkSystem : public OSystem {
+public:
+	BenchmarkSystem() : _mixer(0) {}
+	~BenchmarkSystem() { delete _mixer; }
+
+	void setScreenFormat(const Graphics::PixelFormat &format) { _screenFormat = format; }
+
+	virtual const GraphicsMode *getSupportedGraphicsModes() const {
+		static const GraphicsMode modes[] = { { 0, 0, 0 } };
+		return modes;
+	}
+	virtual int getDefaultGraphicsMode() const { return 0; }
+	virtual bool setGraphicsMode(int mode) { return true; }
+	virtual int getGraphicsMode() const { return 0; }
+	virtual Graphics::PixelFormat getScreenFormat() const { return _screenFormat; }
+	virtual Common::List<Graphics::PixelFormat> getSupportedFormats() const {
+		Common::List<Graphics::PixelFormat> formats;
+		formats.push_back(_screenFormat);
+		return formats;
+	}
+	virtual void initSize(uint width, uint height, const Graphics::PixelFormat *format = NULL) {}
+	virtual int16 getHeight() { return 0; }
+	virtual int16 getWidth() { return 0; }
+	virtual PaletteManager *getPaletteManager() { return 0; }
+	virtual void copyRectToScreen(const void *buf, int pitch, int x, int y, int w, int h) {}
+	virtual Graphics::Surface *lockScreen() { return 0; }
+	virtual void unlockScreen() {}
+	virtual void fillScreen(uint32 col) {}
+	virtual void updateScreen() {}
+	virtual void setShakePos(int shakeOffset) {}
+	virtual void showOverlay() {}
+	virtual void hideOverlay() {}
+	virtual Graphics::PixelFormat getOverlayFormat() const { return _screenFormat; }
+	virtual void clearOverlay() {}
+	virtual void grabOverlay(void *buf, int pitch) {}
+	virtual void copyRectToOverlay(const void *buf, int pitch, int x, int y, int w, int h) {}
+	virtual int16 getOverlayHeight() { return 0; }
+	virtual int16 getOverlayWidth() { return 0; }
+	virtual bool showMouse(bool visible) { return false; }
+	virtual void warpMouse(int x, int y) {}
+	virtual void setMouseCursor(const void *buf, uint w, uint h, int hotspotX, int hotspotY, uint32 keycolor, bool dontScale = false, const Graphics::PixelFormat *format = NULL) {}
+
+	virtual uint32 getMillis(bool skipRecord = false) {
+		struct timeval tv;
+		gettimeofday(&tv, 0);
+		return tv.tv_sec * 1000 + tv.tv_usec / 1000;
+	}
+	virtual void delayMillis(uint msecs) { usleep(msecs * 1000); }
+	virtual void getTimeAndDate(TimeDate &t) const { memset(&t, 0, sizeof(t)); }
+
+	// The benchmark is single threaded
+	virtual MutexRef createMutex() { return 0; }
+	virtual void lockMutex(MutexRef mutex) {}
+	virtual void unlockMutex(MutexRef mutex) {}
+	virtual void deleteMutex(MutexRef mutex) {}
+
+	virtual Audio::Mixer *getMixer() {
+		// Created on demand since the mixer needs g_system to exist
+		if (!_mixer)
+			_mixer = new Audio::MixerImpl(this, 44100);
+		return _mixer;
+	}
+
+	virtual void quit() { exit(0); }
+	virtual void displayMessageOnOSD(const char *msg) {}
+	virtual void displayActivityIconOnOSD(const Graphics::Surface *icon) {}
+
+	virtual void logMessage(LogMessageType::Type type, const char *message) {
+		if (type != LogMessageType::kDebug)
+			fputs(message, stderr);
+	}
+
+private:
+	Graphics::PixelFormat _screenFormat;
+	Audio::MixerImpl *_mixer;
+};
+
+/**
+ * A read stream for a file on the host, so that decoders read their data the
+ * same way they do in the engines instead of from a preloaded copy.
+ */
+class HostFileReadStream : public Common::SeekableReadStream {
+public:
+	HostFileReadStream(FILE *file) : _file(file), _eos(false) {
+		fseek(_file, 0, SEEK_END);
+		_size = ftell(_file);
+		fseek(_file, 0, SEEK_SET);
+	}
+	~HostFileReadStream() { fclose(_file); }
+
+	virtual bool err() const { return ferror(_file) != 0; }
+	virtual void clearErr() { clearerr(_file); _eos = false; }
+	virtual bool eos() const { return _eos; }
+
+	virtual uint32 read(void *dataPtr, uint32 dataSize) {
+		uint32 n = fread(dataPtr, 1, dataSize, _file);
+		if (n < dataSize)
+			_eos = true;
+		return n;
+	}
+
+	virtual int32 pos() const { return ftell(_file); }
+	virtual int32 size() const { return _size; }
+
+	virtual bool seek(int32 offset, int whence = SEEK_SET) {
+		_eos = false;
+		return fseek(_file, offset, whence) == 0;
+	}
+
+private:
+	FILE *_file;
+	int32 _size;
+	bool _eos;
+};
+
+struct OutputFormat {
+	const char *name;
+	Graphics::PixelFormat format;
+};
+
+// The YUV based decoders always convert to RGB while decoding, with a
+// different conversion for each output depth, so both are measured
+const OutputFormat kOutputFormats[] = {
+	{ "rgb565", Graphics::PixelFormat(2, 5, 6, 5, 0, 11, 5, 0, 0) },
+	{ "argb8888", Graphics::PixelFormat(4, 8, 8, 8, 8, 16, 8, 0, 24) }
+};
+
+enum {
+	kOutputFormatCount = ARRAYSIZE(kOutputFormats),
+	/** The number of missing frames after which a decoder is assumed stuck. */
+	kMaxEmptyFrames = 100
+};
+
+/** Returns the container format of the given file, from its extension. */
+Common::String getContainerName(const Common::String &fileName) {
+	const char *extension = strrchr(fileName.c_str(), '.');
+	Common::String name(extension ? extension + 1 : "");
+	name.toLowercase();
+	return name;
+}
+
+/** Returns a decoder for the given container format, or 0 if there is none. */
+Video::VideoDecoder *createDecoder(const Common::String &containerName) {
+	if (containerName == "avi")
+		return new Video::AVIDecoder();
+#ifdef USE_BINK
+	if (containerName == "bik")
+		return new Video::BinkDecoder();
+#endif
+	if (containerName == "dxa")
+		return new Video::DXADecoder();
+	if (containerName == "fli" || containerName == "flc")
+		return new Video::FlicDecoder();
+	if (containerName == "mov")
+		return new Video::QuickTimeDecoder();
+	if (containerName == "mpg")
+		return new Video::MPEGPSDecoder();
+#ifdef USE_THEORADEC
+	if (containerName == "ogv")
+		return new Video::TheoraDecoder();
+#endif
+	if (containerName == "smk")
+		return new Video::SmackerDecoder();
+	if (containerName == "str")
+		return new Video::PSXStreamDecoder(Video::PSXStreamDecoder::kCD2x);
+#if defined(ENABLE_GOB) || defined(ENABLE_SCI32) || defined(DYNAMIC_MODULES)
+	if (containerName == "vmd")
+		return new Video::AdvancedVMDDecoder();
+#endif
+
+	return 0;
+}
+
+uint32 getMicroseconds() {
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec * 1000000 + ts.tv_nsec / 1000;
+}
+
+bool writeAll(int fd, const void *data, size_t size) {
+	const byte *ptr = (const byte *)data;
+	while (size > 0) {
+		ssize_t n = write(fd, ptr, size);
+		if (n <= 0)
+			return false;
+		ptr += n;
+		size -= n;
+	}
+	return true;
+}
+
+bool readAll(int fd, void *data, size_t size) {
+	byte *ptr = (byte *)data;
+	while (size > 0) {
+		ssize_t n = read(fd, ptr, size);
+		if (n <= 0)
+			return false;
+		ptr += n;
+		size -= n;
+	}
+	return true;
+}
+
+void writeString(int fd, const Common::String &str) {
+	uint32 size = str.size();
+	writeAll(fd, &size, sizeof(size));
+	if (size)
+		writeAll(fd, str.c_str(), size);
+}
+
+bool readString(int fd, Common::String &str) {
+	uint32 size;
+	if (!readAll(fd, &size, sizeof(size)))
+		return false;
+
+	Common::Array<char> data(size);
+	if (size && !readAll(fd, &data[0], size))
+		return false;
+
+	str = size ? Common::String(&data[0], size) : Common::String();
+	return true;
+}
+
+/**
+ * Returns the name used to group the results of a file. Containers like AVI
+ * and QuickTime hold many different codecs, so these are told apart by the
+ * codec tag of the video track.
+ */
+Common::String getCodecName(const Common::String &containerName, const Video::VideoDecoder &decoder) {
+	uint32 tag = decoder.getVideoCodecTag();
+	if (!tag)
+		return containerName;
+
+	return containerName + "/" + Common::tag2string(tag);
+}
+
+/**
+ * Decodes every frame of a file to the given output format and sends the
+ * codec name and the decoding time of each frame to fd. This runs in the
+ * child process.
+ */
+void decodeFile(const Common::String &path, const OutputFormat &outputFormat, int fd) {
+	uint32 frameCount = 0xFFFFFFFF;
+	Common::String containerName = getContainerName(path);
+
+	FILE *file = fopen(path.c_str(), "rb");
+	Video::VideoDecoder *decoder = file ? createDecoder(containerName) : 0;
+	if (!decoder) {
+		if (file)
+			fclose(file);
+		writeString(fd, containerName);
+		writeAll(fd, &frameCount, sizeof(frameCount));
+		return;
+	}
+
+	((BenchmarkSystem *)g_system)->setScreenFormat(outputFormat.format);
+	decoder->setDefaultHighColorFormat(outputFormat.format);
+
+	if (!decoder->loadStream(new HostFileReadStream(file))) {
+		delete decoder;
+		writeString(fd, containerName);
+		writeAll(fd, &frameCount, sizeof(frameCount));
+		return;
+	}
+
+	writeString(fd, getCodecName(containerName, *decoder));
+
+	Common::Array<uint32> frameTimes;
+	uint emptyFrames = 0;
+	while (!decoder->endOfVideo() && emptyFrames < kMaxEmptyFrames) {
+		uint32 start = getMicroseconds();
+		const Graphics::Surface *frame = decoder->decodeNextFrame();
+		uint32 time = getMicroseconds() - start;
+
+		if (frame) {
+			frameTimes.push_back(time);
+			emptyFrames = 0;
+		} else {
+			++emptyFrames;
+		}
+	}
+
+	delete decoder;
+
+	frameCount = frameTimes.size();
+	writeAll(fd, &frameCount, sizeof(frameCount));
+	if (frameCount)
+		writeAll(fd, &frameTimes[0], frameCount * sizeof(uint32));
+}
+
+struct PassStats {
+	PassStats() : totalTime(0), peakMemory(0) {}
+
+	Common::Array<uint32> frameTimes;
+	uint64 totalTime;
+	long peakMemory;
+};
+
+struct CodecStats {
+	Common::String name;
+	uint fileCount;
+	PassStats passes[kOutputFormatCount];
+};
+
+/**
+ * Runs decodeFile() in a child process and adds its results to stats.
+ * Returns false if the file could not be decoded.
+ */
+bool benchmarkFile(const Common::String &path, const OutputFormat &outputFormat, PassStats &stats, Common::String &codecName) {
+	int fds[2];
+	if (pipe(fds) != 0)
+		error("Could not create a pipe");
+
+	fflush(stdout);
+	fflush(stderr);
+
+	pid_t pid = fork();
+	if (pid < 0)
+		error("Could not start a process");
+
+	if (pid == 0) {
+		close(fds[0]);
+		decodeFile(path, outputFormat, fds[1]);
+		close(fds[1]);
+		_exit(0);
+	}
+
+	close(fds[1]);
+
+	uint32 frameCount;
+	Common::Array<uint32> frameTimes;
+	bool success = readString(fds[0], codecName) &&
+	               readAll(fds[0], &frameCount, sizeof(frameCount)) && frameCount != 0xFFFFFFFF;
+	if (success && frameCount) {
+		frameTimes.resize(frameCount);
+		success = readAll(fds[0], &frameTimes[0], frameCount * sizeof(uint32));
+	}
+	close(fds[0]);
+
+	int status;
+	struct rusage usage;
+	if (wait4(pid, &status, 0, &usage) != pid || !WIFEXITED(status) || WEXITSTATUS(status) != 0)
+		success = false;
+
+	if (!success)
+		return false;
+
+	uint64 totalTime = 0;
+	for (uint i = 0; i < frameTimes.size(); i++) {
+		stats.frameTimes.push_back(frameTimes[i]);
+		totalTime += frameTimes[i];
+	}
+
+	stats.totalTime += totalTime;
+	stats.peakMemory = MAX<long>(stats.peakMemory, usage.ru_maxrss);
+
+	printf("  %-9s %6u frames %9.1f fps %8ld KB\n", outputFormat.name, frameCount,
+	       totalTime ? frameCount * 1000000.0 / totalTime : 0.0, (long)usage.ru_maxrss);
+	return true;
+}
+
+void addPassStats(PassStats &total, const PassStats &stats) {
+	for (uint i = 0; i < stats.frameTimes.size(); i++)
+		total.frameTimes.push_back(stats.frameTimes[i]);
+
+	total.totalTime += stats.totalTime;
+	total.peakMemory = MAX<long>(total.peakMemory, stats.peakMemory);
+}
+
+/** Returns the frame time in milliseconds below which the given share of frames lie. */
+double getPercentile(const Common::Array<uint32> &sortedTimes, uint percent) {
+	if (sortedTimes.empty())
+		return 0;
+
+	uint index = (sortedTimes.size() - 1) * percent / 100;
+	return sortedTimes[index] / 1000.0;
+}
+
+void printSummary(Common::Array<CodecStats> &codecs) {
+	printf("\n%-10s %-9s %5s %8s %9s %8s %8s %8s %8s %10s\n",
+	       "codec", "output", "files", "frames", "fps", "p50 ms", "p90 ms", "p99 ms", "max ms", "peak KB");
+
+	for (uint i = 0; i < codecs.size(); i++) {
+		for (uint j = 0; j < kOutputFormatCount; j++) {
+			PassStats &stats = codecs[i].passes[j];
+			Common::sort(stats.frameTimes.begin(), stats.frameTimes.end());
+
+			printf("%-10s %-9s %5u %8u %9.1f %8.2f %8.2f %8.2f %8.2f %10ld\n",
+			       codecs[i].name.c_str(), kOutputFormats[j].name, codecs[i].fileCount, stats.frameTimes.size(),
+			       stats.totalTime ? stats.frameTimes.size() * 1000000.0 / stats.totalTime : 0.0,
+			       getPercentile(stats.frameTimes, 50), getPercentile(stats.frameTimes, 90),
+			       getPercentile(stats.frameTimes, 99), getPercentile(stats.frameTimes, 100),
+			       stats.peakMemory);
+		}
+	}
+}
+
+} // End of anonymous namespace
+
+int main(int argc, char *argv[]) {
+	if (argc != 2) {
+		printf("Usage: %s <directory>\n\n", argv[0]);
+		printf("Decodes every video in the directory as fast as possible and reports the\n");
+		printf("decoding speed and peak memory use for each codec.\n");
+		return 1;
+	}
+
+	BenchmarkSystem *system = new BenchmarkSystem();
+	g_system = system;
+
+	Common::String directory(argv[1]);
+	DIR *dir = opendir(directory.c_str());
+	if (!dir) {
+		printf("Could not open directory %s\n", directory.c_str());
+		return 1;
+	}
+
+	Common::Array<Common::String> fileNames;
+	while (struct dirent *entry = readdir(dir)) {
+		Common::String fileName(entry->d_name);
+		Video::VideoDecoder *decoder = createDecoder(getContainerName(fileName));
+		if (decoder) {
+			fileNames.push_back(fileName);
+			delete decoder;
+		}
+	}
+	closedir(dir);
+
+	Common::sort(fileNames.begin(), fileNames.end());
+
+	Common::Array<CodecStats> codecs;
+	for (uint i = 0; i < fileNames.size(); i++) {
+		printf("%s\n", fileNames[i].c_str());
+
+		Common::String codecName;
+		PassStats passes[kOutputFormatCount];
+		bool decoded = true;
+		for (uint j = 0; j < kOutputFormatCount && decoded; j++)
+			decoded = benchmarkFile(directory + "/" + fileNames[i], kOutputFormats[j], passes[j], codecName);
+
+		if (!decoded) {
+			printf("  failed to decode\n");
+			continue;
+		}
+
+		uint codec = 0;
+		while (codec < codecs.size() && codecs[codec].name != codecName)
+			codec++;
+
+		if (codec == codecs.size()) {
+			codecs.push_back(CodecStats());
+			codecs.back().name = codecName;
+			codecs.back().fileCount = 0;
+		}
+
+		for (uint j = 0; j < kOutputFormatCount; j++)
+			addPassStats(codecs[codec].passes[j], passes[j]);
+		codecs[codec].fileCount++;
+	}
+
+	printSummary(codecs);
+
+	delete system;
+	g_system = 0;
+	return 0;
+}
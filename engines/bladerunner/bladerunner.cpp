@@ -717,6 +717,8 @@ void BladeRunnerEngine::gameTick() {
 	handleEvents();
 
 	if (_gameIsRunning && _windowIsActive) {
+		_sliceAnimations->tickPrefetch();
+
 		// TODO: Only run if not in Kia, script, nor AI
 		if (!_sceneScript->isInsideScript() && !_aiScripts->isInsideScript()) {
 			_settings->openNewScene();
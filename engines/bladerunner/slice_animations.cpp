@@ -124,19 +124,61 @@ bool SliceAnimations::PageFile::open(const Common::String &name) {
 	return true;
 }
 
-void *SliceAnimations::PageFile::loadPage(uint32 pageNumber) {
-	if (_pageOffsets[pageNumber] == -1)
-		return nullptr;
+bool SliceAnimations::PageFile::loadPage(uint32 pageNumber, void *data) {
+	if (_pageOffsets.empty() || _pageOffsets[pageNumber] == -1)
+		return false;
 
 	uint32 pageSize = _sliceAnimations->_pageSize;
 
-	// TODO: Retire oldest pages if we exceed some memory limit
-
-	void *data = malloc(pageSize);
 	_file.seek(_pageOffsets[pageNumber], SEEK_SET);
 	uint32 r = _file.read(data, pageSize);
 	assert(r == pageSize);
 
+	return true;
+}
+
+uint32 SliceAnimations::getFramePage(uint32 animation, uint32 frame) const {
+	return (_animations[animation].offset + frame * _animations[animation].frameSize) / _pageSize;
+}
+
+void *SliceAnimations::retireOldestPage() {
+	int oldest = -1;
+	for (uint32 i = 0; i != _loadedPages.size(); ++i) {
+		const Page &page = _pages[_loadedPages[i]];
+		if (page._pinCount == 0 && (oldest == -1 || page._lastAccess < _pages[_loadedPages[oldest]]._lastAccess))
+			oldest = i;
+	}
+
+	// Everything is in use, so the cache has to grow past its limit
+	if (oldest == -1)
+		return nullptr;
+
+	Page &page = _pages[_loadedPages[oldest]];
+	void *data = page._data;
+	page._data = nullptr;
+
+	_loadedPages[oldest] = _loadedPages.back();
+	_loadedPages.pop_back();
+
+	return data;
+}
+
+void *SliceAnimations::loadPage(uint32 page) {
+	void *data = nullptr;
+	if ((_loadedPages.size() + 1) * _pageSize > (uint32)kPageCacheSize)
+		data = retireOldestPage();
+
+	if (!data)
+		data = malloc(_pageSize);
+
+	if (!_coreAnimPageFile.loadPage(page, data) && !_framesPageFile.loadPage(page, data)) {
+		free(data);
+		return nullptr;
+	}
+
+	_pages[page]._data = data;
+	_loadedPages.push_back(page);
+
 	return data;
 }
 
@@ -147,20 +189,50 @@ void *SliceAnimations::getFramePtr(uint32 animation, uint32 frame) {
 	uint32 page        = frameOffset / _pageSize;
 	uint32 pageOffset  = frameOffset % _pageSize;
 
-	if (!_pages[page]._data)
-		_pages[page]._data = _coreAnimPageFile.loadPage(page);
-
-	if (!_pages[page]._data)
-		_pages[page]._data = _framesPageFile.loadPage(page);
-
-	if (!_pages[page]._data)
+	if (!_pages[page]._data && !loadPage(page))
 		error("Unable to locate page %d for animation %d frame %d", page, animation, frame);
 
-	_pages[page]._lastAccess = _vm->_system->getMillis();
+	_pages[page]._lastAccess = ++_accessCounter;
 
 	return (byte *)_pages[page]._data + pageOffset;
 }
 
+void SliceAnimations::pinFrame(uint32 animation, uint32 frame) {
+	++_pages[getFramePage(animation, frame)]._pinCount;
+}
+
+void SliceAnimations::unpinFrame(uint32 animation, uint32 frame) {
+	Page &page = _pages[getFramePage(animation, frame)];
+	assert(page._pinCount > 0);
+	--page._pinCount;
+}
+
+void SliceAnimations::prefetch(int animation) {
+	// Queuing more than fits into the cache would only retire pages which
+	// were prefetched earlier
+	uint32 maxQueuedPages = kPageCacheSize / _pageSize / 2;
+
+	uint32 frameCount = _animations[animation].frameCount;
+	for (uint32 i = 0; i != frameCount && _prefetchQueue.size() < maxQueuedPages; ++i) {
+		uint32 page = getFramePage(animation, i);
+		if (!_pages[page]._data && !_pages[page]._queued) {
+			_pages[page]._queued = true;
+			_prefetchQueue.push_back(page);
+		}
+	}
+}
+
+void SliceAnimations::tickPrefetch() {
+	for (int i = 0; i != kPrefetchPagesPerTick && !_prefetchQueue.empty(); ++i) {
+		uint32 page = _prefetchQueue.front();
+		_prefetchQueue.remove_at(0);
+
+		_pages[page]._queued = false;
+		if (!_pages[page]._data && loadPage(page))
+			_pages[page]._lastAccess = ++_accessCounter;
+	}
+}
+
 Vector3 SliceAnimations::getPositionChange(int animation) const {
 	return _animations[animation].positionChange;
 }
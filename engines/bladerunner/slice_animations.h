@@ -59,8 +59,10 @@ class SliceAnimations {
 	struct Page {
 		void   *_data;
 		uint32 _lastAccess;
+		uint32 _pinCount;
+		bool   _queued;
 
-		Page() : _data(nullptr), _lastAccess(0) {}
+		Page() : _data(nullptr), _lastAccess(0), _pinCount(0), _queued(false) {}
 	};
 
 	struct PageFile {
@@ -70,8 +72,15 @@ class SliceAnimations {
 
 		PageFile(SliceAnimations *sliceAnimations) : _sliceAnimations(sliceAnimations) {}
 
-		bool  open(const Common::String &name);
-		void *loadPage(uint32 page);
+		bool open(const Common::String &name);
+		bool loadPage(uint32 page, void *data);
+	};
+
+	enum {
+		// Loaded pages beyond this size are retired, oldest first
+		kPageCacheSize = 32 * 1024 * 1024,
+		// Number of queued pages loaded by each call to tickPrefetch()
+		kPrefetchPagesPerTick = 2
 	};
 
 	BladeRunnerEngine *_vm;
@@ -85,9 +94,17 @@ class SliceAnimations {
 	Common::Array<Animation>    _animations;
 	Common::Array<Page>         _pages;
 
+	uint32                      _accessCounter;
+	Common::Array<uint32>       _loadedPages;
+	Common::Array<uint32>       _prefetchQueue;
+
 	PageFile _coreAnimPageFile;
 	PageFile _framesPageFile;
 
+	uint32 getFramePage(uint32 animation, uint32 frame) const;
+	void  *loadPage(uint32 page);
+	void  *retireOldestPage();
+
 public:
 	SliceAnimations(BladeRunnerEngine *vm)
 		: _vm(vm)
@@ -96,7 +113,8 @@ public:
 		, _timestamp(0)
 		, _pageSize(0)
 		, _pageCount(0)
-		, _paletteCount(0) {}
+		, _paletteCount(0)
+		, _accessCounter(0) {}
 	~SliceAnimations();
 
 	bool open(const Common::String &name);
@@ -107,6 +125,14 @@ public:
 	Palette &getPalette(int i) { return _palettes[i]; };
 	void    *getFramePtr(uint32 animation, uint32 frame);
 
+	// A pinned frame stays loaded, so pointers to it remain valid
+	void pinFrame(uint32 animation, uint32 frame);
+	void unpinFrame(uint32 animation, uint32 frame);
+
+	// Queue the pages of an animation to be loaded by tickPrefetch()
+	void prefetch(int animation);
+	void tickPrefetch();
+
 	int   getFrameCount(int animation) const { return _animations[animation].frameCount; }
 	float getFPS(int animation) const { return _animations[animation].fps; }
 
@@ -52,6 +52,9 @@ SliceRenderer::SliceRenderer(BladeRunnerEngine *vm) {
 	_setEffects    = nullptr;
 	_sliceFramePtr = nullptr;
 
+	_litColorCacheGeneration = 0;
+	memset(_litColorCacheStamp, 0, sizeof(_litColorCacheStamp));
+
 	_frameBottomZ      = 0.0f;
 	_frameSliceHeight  = 0.0f;
 	_framePaletteIndex = 0;
@@ -262,9 +265,14 @@ void SliceRenderer::calculateBoundingRect() {
 }
 
 void SliceRenderer::loadFrame(int animation, int frame) {
+	// Only the current frame is pinned, older frame pointers are not kept
+	if (_sliceFramePtr)
+		_vm->_sliceAnimations->unpinFrame(_animation, _frame);
+
 	_animation = animation;
 	_frame = frame;
 	_sliceFramePtr = _vm->_sliceAnimations->getFramePtr(_animation, _frame);
+	_vm->_sliceAnimations->pinFrame(_animation, _frame);
 
 	Common::MemoryReadStream stream((byte *)_sliceFramePtr, _vm->_sliceAnimations->_animations[_animation].frameSize);
 
@@ -553,6 +561,26 @@ void SliceRenderer::drawSlice(int slice, bool advanced, uint16 *frameLinePtr, ui
 
 	uint32 polyCount = READ_LE_UINT32(p);
 	p += 4;
+
+	// Lighting only changes between lines, so unless a screen effect covers
+	// this line the color of a palette entry is the same for all its pixels
+	bool cacheLitColors = false;
+	if (advanced) {
+		cacheLitColors = true;
+		for (uint i = 0; i < _screenEffects->_entries.size(); ++i) {
+			const ScreenEffects::Entry &entry = _screenEffects->_entries[i];
+			if ((uint16)((y / 2) - entry.y) < entry.height) {
+				cacheLitColors = false;
+				break;
+			}
+		}
+
+		if (cacheLitColors && ++_litColorCacheGeneration == 0) {
+			memset(_litColorCacheStamp, 0, sizeof(_litColorCacheStamp));
+			_litColorCacheGeneration = 1;
+		}
+	}
+
 	while (polyCount--) {
 		uint32 vertexCount = READ_LE_UINT32(p);
 		p += 4;
@@ -571,21 +599,32 @@ void SliceRenderer::drawSlice(int slice, bool advanced, uint16 *frameLinePtr, ui
 			if (vertexX > previousVertexX) {
 				int vertexZ = (_m21lookup[p[0]] + _m22lookup[p[1]] + _m23) >> 6;
 
+				// Find the first visible pixel before working out the color,
+				// as the span is often hidden completely
+				int x = previousVertexX;
 				if (vertexZ >= 0 && vertexZ < 65536) {
-					int color555 = palette.color555[p[2]];
-					if (advanced) {
+					while (x != vertexX && vertexZ >= zbufLinePtr[x])
+						++x;
+				} else {
+					x = vertexX;
+				}
+
+				if (x != vertexX) {
+					uint16 color555 = palette.color555[p[2]];
+					if (cacheLitColors) {
+						if (_litColorCacheStamp[p[2]] != _litColorCacheGeneration) {
+							Color256 aescColor = { 0, 0, 0 };
+							_litColorCache[p[2]] = calculateLitColor(palette.color[p[2]], aescColor);
+							_litColorCacheStamp[p[2]] = _litColorCacheGeneration;
+						}
+						color555 = _litColorCache[p[2]];
+					} else if (advanced) {
 						Color256 aescColor = { 0, 0, 0 };
 						_screenEffects->getColor(&aescColor, vertexX, y, vertexZ);
-
-						Color256 color = palette.color[p[2]];
-						color.r = ((int)(_setEffectColor.r + _lightsColor.r * color.r) >> 16) + aescColor.r;
-						color.g = ((int)(_setEffectColor.g + _lightsColor.g * color.g) >> 16) + aescColor.g;
-						color.b = ((int)(_setEffectColor.b + _lightsColor.b * color.b) >> 16) + aescColor.b;
-
-						int bladeToScummVmConstant = 256 / 32;
-						color555 = _pixelFormat.RGBToColor(CLIP(color.r * bladeToScummVmConstant, 0, 255), CLIP(color.g * bladeToScummVmConstant, 0, 255), CLIP(color.b * bladeToScummVmConstant, 0, 255));
+						color555 = calculateLitColor(palette.color[p[2]], aescColor);
 					}
-					for (int x = previousVertexX; x != vertexX; ++x) {
+
+					for (; x != vertexX; ++x) {
 						if (vertexZ < zbufLinePtr[x]) {
 							frameLinePtr[x] = color555;
 							zbufLinePtr[x] = (uint16)vertexZ;
@@ -599,6 +638,16 @@ void SliceRenderer::drawSlice(int slice, bool advanced, uint16 *frameLinePtr, ui
 	}
 }
 
+uint16 SliceRenderer::calculateLitColor(const Color256 &paletteColor, const Color256 &aescColor) const {
+	Color256 color = paletteColor;
+	color.r = ((int)(_setEffectColor.r + _lightsColor.r * color.r) >> 16) + aescColor.r;
+	color.g = ((int)(_setEffectColor.g + _lightsColor.g * color.g) >> 16) + aescColor.g;
+	color.b = ((int)(_setEffectColor.b + _lightsColor.b * color.b) >> 16) + aescColor.b;
+
+	int bladeToScummVmConstant = 256 / 32;
+	return _pixelFormat.RGBToColor(CLIP(color.r * bladeToScummVmConstant, 0, 255), CLIP(color.g * bladeToScummVmConstant, 0, 255), CLIP(color.b * bladeToScummVmConstant, 0, 255));
+}
+
 void SliceRenderer::drawShadowInWorld(int transparency, Graphics::Surface &surface, uint16 *zbuffer) {
 	Matrix4x3 mOffset(
 		1.0f, 0.0f, 0.0f, _framePos.x,
@@ -735,10 +784,7 @@ void SliceRenderer::drawShadowPolygon(int transparency, Graphics::Surface &surfa
 }
 
 void SliceRenderer::preload(int animationId) {
-	int frameCount = _vm->_sliceAnimations->getFrameCount(animationId);
-	for (int i = 0; i < frameCount; ++i) {
-		_vm->_sliceAnimations->getFramePtr(animationId, i);
-	}
+	_vm->_sliceAnimations->prefetch(animationId);
 }
 
 void SliceRenderer::disableShadows(int animationsIdsList[], int listSize) {
@@ -89,6 +89,12 @@ class SliceRenderer {
 	Color _setEffectColor;
 	Color _lightsColor;
 
+	// Lit colors of the palette entries used by the line being drawn, valid
+	// while their stamp matches the current generation
+	uint16 _litColorCache[256];
+	uint32 _litColorCacheStamp[256];
+	uint32 _litColorCacheGeneration;
+
 	Graphics::PixelFormat _pixelFormat;
 
 public:
@@ -115,6 +121,7 @@ private:
 	void loadFrame(int animation, int frame);
 
 	void drawSlice(int slice, bool advanced, uint16 *frameLinePtr, uint16 *zbufLinePtr, int y);
+	uint16 calculateLitColor(const Color256 &paletteColor, const Color256 &aescColor) const;
 	void drawShadowInWorld(int transparency, Graphics::Surface &surface, uint16 *zbuffer);
 	void drawShadowPolygon(int transparency, Graphics::Surface &surface, uint16 *zbuffer);
 };
@@ -120,6 +120,10 @@ const char *strTag(uint32 tag) {
 VQADecoder::VQADecoder() {
 	_s                   = nullptr;
 	_frameInfo           = nullptr;
+	_prefetchedFrame     = -1;
+	_prefetchData        = nullptr;
+	_prefetchSize        = 0;
+	_prefetchCapacity    = 0;
 	_videoTrack          = nullptr;
 	_audioTrack          = nullptr;
 	_maxVIEWChunkSize    = 0;
@@ -157,11 +161,13 @@ VQADecoder::~VQADecoder() {
 	delete _audioTrack;
 	delete _videoTrack;
 	delete[] _frameInfo;
+	delete[] _prefetchData;
 }
 
 bool VQADecoder::loadStream(Common::SeekableReadStream *s) {
 	// close();
 	_s = s;
+	_prefetchedFrame = -1;
 
 	IFFChunkHeader chd;
 	uint32 type;
@@ -242,16 +248,16 @@ void VQADecoder::decodeLights(Lights *lights) {
 	_videoTrack->decodeLights(lights);
 }
 
-void VQADecoder::readPacket(uint readFlags) {
+void VQADecoder::readPacket(Common::SeekableReadStream *s, uint readFlags) {
 	IFFChunkHeader chd;
 
-	if (remain(_s) < 8) {
-		warning("VQADecoder::readPacket: remain: %d", remain(_s));
-		assert(remain(_s) < 8);
+	if (remain(s) < 8) {
+		warning("VQADecoder::readPacket: remain: %d", remain(s));
+		assert(remain(s) < 8);
 	}
 
 	do {
-		if (!readIFFChunkHeader(_s, &chd)) {
+		if (!readIFFChunkHeader(s, &chd)) {
 			error("VQADecoder::readPacket: Error reading chunk header");
 			return;
 		}
@@ -259,18 +265,18 @@ void VQADecoder::readPacket(uint readFlags) {
 		bool rc = false;
 		// Video track
 		switch (chd.id) {
-		case kAESC: rc = ((readFlags & kVQAReadCustom) == 0) ? _s->skip(roundup(chd.size)) : _videoTrack->readAESC(_s, chd.size); break;
-		case kLITE: rc = ((readFlags & kVQAReadCustom) == 0) ? _s->skip(roundup(chd.size)) : _videoTrack->readLITE(_s, chd.size); break;
-		case kVIEW: rc = ((readFlags & kVQAReadCustom) == 0) ? _s->skip(roundup(chd.size)) : _videoTrack->readVIEW(_s, chd.size); break;
-		case kVQFL: rc = ((readFlags & kVQAReadVideo ) == 0) ? _s->skip(roundup(chd.size)) : _videoTrack->readVQFL(_s, chd.size, readFlags); break;
-		case kVQFR: rc = ((readFlags & kVQAReadVideo ) == 0) ? _s->skip(roundup(chd.size)) : _videoTrack->readVQFR(_s, chd.size, readFlags); break;
-		case kZBUF: rc = ((readFlags & kVQAReadCustom) == 0) ? _s->skip(roundup(chd.size)) : _videoTrack->readZBUF(_s, chd.size); break;
+		case kAESC: rc = ((readFlags & kVQAReadCustom) == 0) ? s->skip(roundup(chd.size)) : _videoTrack->readAESC(s, chd.size); break;
+		case kLITE: rc = ((readFlags & kVQAReadCustom) == 0) ? s->skip(roundup(chd.size)) : _videoTrack->readLITE(s, chd.size); break;
+		case kVIEW: rc = ((readFlags & kVQAReadCustom) == 0) ? s->skip(roundup(chd.size)) : _videoTrack->readVIEW(s, chd.size); break;
+		case kVQFL: rc = ((readFlags & kVQAReadVideo ) == 0) ? s->skip(roundup(chd.size)) : _videoTrack->readVQFL(s, chd.size, readFlags); break;
+		case kVQFR: rc = ((readFlags & kVQAReadVideo ) == 0) ? s->skip(roundup(chd.size)) : _videoTrack->readVQFR(s, chd.size, readFlags); break;
+		case kZBUF: rc = ((readFlags & kVQAReadCustom) == 0) ? s->skip(roundup(chd.size)) : _videoTrack->readZBUF(s, chd.size); break;
 		// Sound track
-		case kSN2J: rc = ((readFlags & kVQAReadAudio) == 0) ? _s->skip(roundup(chd.size)) : _audioTrack->readSN2J(_s, chd.size); break;
-		case kSND2: rc = ((readFlags & kVQAReadAudio) == 0) ? _s->skip(roundup(chd.size)) : _audioTrack->readSND2(_s, chd.size); break;
+		case kSN2J: rc = ((readFlags & kVQAReadAudio) == 0) ? s->skip(roundup(chd.size)) : _audioTrack->readSN2J(s, chd.size); break;
+		case kSND2: rc = ((readFlags & kVQAReadAudio) == 0) ? s->skip(roundup(chd.size)) : _audioTrack->readSND2(s, chd.size); break;
 		default:
 			rc = false;
-			_s->skip(roundup(chd.size));
+			s->skip(roundup(chd.size));
 		}
 
 		if (!rc) {
@@ -286,10 +292,51 @@ void VQADecoder::readFrame(int frame, uint readFlags) {
 	}
 
 	uint32 frameOffset = 2 * (_frameInfo[frame] & 0x0FFFFFFF);
+	_readingFrame = frame;
+
+	if (frame == _prefetchedFrame) {
+		Common::MemoryReadStream prefetchStream(_prefetchData, _prefetchSize);
+		readPacket(&prefetchStream, readFlags);
+		return;
+	}
+
 	_s->seek(frameOffset);
+	readPacket(_s, readFlags);
+}
 
-	_readingFrame = frame;
-	readPacket(readFlags);
+void VQADecoder::prefetchFrame(int frame) {
+	if (frame == _prefetchedFrame || frame < 0 || frame >= numFrames()) {
+		return;
+	}
+
+	uint32 frameOffset = 2 * (_frameInfo[frame] & 0x0FFFFFFF);
+	uint32 frameEnd;
+	if (frame + 1 < numFrames()) {
+		frameEnd = 2 * (_frameInfo[frame + 1] & 0x0FFFFFFF);
+	} else {
+		frameEnd = _s->size();
+	}
+
+	if (frameEnd <= frameOffset) {
+		return;
+	}
+
+	uint32 size = frameEnd - frameOffset;
+	if (size > _prefetchCapacity) {
+		delete[] _prefetchData;
+		_prefetchData = new uint8[size];
+		_prefetchCapacity = size;
+	}
+
+	_prefetchedFrame = -1;
+	_s->seek(frameOffset);
+	if (_s->read(_prefetchData, size) != size) {
+		warning("VQADecoder::prefetchFrame: Error reading frame %d", frame);
+		return;
+	}
+
+	_prefetchSize = size;
+	_prefetchedFrame = frame;
 }
 
 bool VQADecoder::readVQHD(Common::SeekableReadStream *s, uint32 size) {
@@ -63,6 +63,13 @@ public:
 
 	void readFrame(int frame, uint readFlags = kVQAReadAll);
 
+	/**
+	 * Reads the raw data of the given frame into memory so that a following
+	 * readFrame() for the same frame does not have to touch the stream.
+	 * Meant to be called while the player waits for the next frame to be due.
+	 */
+	void prefetchFrame(int frame);
+
 	void                        decodeVideoFrame(Graphics::Surface *surface, int frame, bool forceDraw = false);
 	void                        decodeZBuffer(ZBuffer *zbuffer);
 	Audio::SeekableAudioStream *decodeAudioFrame();
@@ -152,6 +159,11 @@ private:
 
 	uint32  *_frameInfo;
 
+	int      _prefetchedFrame;
+	uint8   *_prefetchData;
+	uint32   _prefetchSize;
+	uint32   _prefetchCapacity;
+
 	uint32   _maxVIEWChunkSize;
 	uint32   _maxZBUFChunkSize;
 	uint32   _maxAESCChunkSize;
@@ -159,7 +171,7 @@ private:
 	VQAVideoTrack *_videoTrack;
 	VQAAudioTrack *_audioTrack;
 
-	void readPacket(uint readFlags);
+	void readPacket(Common::SeekableReadStream *s, uint readFlags);
 
 	bool readVQHD(Common::SeekableReadStream *s, uint32 size);
 	bool readMSCI(Common::SeekableReadStream *s, uint32 size);
@@ -107,6 +107,9 @@ int VQAPlayer::update(bool forceDraw, bool advanceFrame, Graphics::Surface *cust
 	} else if (_frameNext > _frameEnd) {
 		result = -3;
 	} else if (now < _frameNextTime) {
+		// Use the time until the frame is due to get its data off the disk,
+		// so that loading it does not stall the tick that displays it
+		_decoder.prefetchFrame(_frameNext);
 		result = -1;
 	} else if (advanceFrame) {
 		_frame = _frameNext;
@@ -95,6 +95,12 @@ Frame::Frame(const Frame &frame) {
 
 Frame::~Frame() {
 	delete _palette;
+
+	for (uint16 i = 0; i < _sprites.size(); i++)
+		delete _sprites[i];
+
+	for (uint16 i = 0; i < _drawRects.size(); i++)
+		delete _drawRects[i];
 }
 
 void Frame::readChannel(Common::SeekableSubReadStreamEndian &stream, uint16 offset, uint16 size) {
@@ -403,6 +409,8 @@ void Frame::readSprite(Common::SeekableSubReadStreamEndian &stream, uint16 offse
 }
 
 void Frame::prepareFrame(Score *score) {
+	for (uint16 i = 0; i < _drawRects.size(); i++)
+		delete _drawRects[i];
 	_drawRects.clear();
 	renderSprites(*score->_surface, false);
 	renderSprites(*score->_trailSurface, true);
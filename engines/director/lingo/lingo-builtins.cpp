@@ -1168,10 +1168,12 @@ void Lingo::b_move(int nargs) {
 }
 
 void Lingo::b_moveableSprite(int nargs) {
-	Frame *frame = g_director->getCurrentScore()->_frames[g_director->getCurrentScore()->getCurrentFrame()];
+	Score *score = g_director->getCurrentScore();
+	Frame *frame = score->getFrame(score->getCurrentFrame());
 
 	// Will have no effect
 	frame->_sprites[g_lingo->_currentEntityId]->_moveable = true;
+	score->markFrameDirty(score->getCurrentFrame());
 
 	g_director->setDraggedSprite(frame->_sprites[g_lingo->_currentEntityId]->_castId);
 }
@@ -1231,7 +1233,7 @@ void Lingo::b_rollOver(int nargs) {
 
 	d.u.i = 0; // FALSE
 
-	Frame *frame = g_director->getCurrentScore()->_frames[g_director->getCurrentScore()->getCurrentFrame()];
+	Frame *frame = g_director->getCurrentScore()->getFrame(g_director->getCurrentScore()->getCurrentFrame());
 
 	if (arg >= (int32) frame->_sprites.size()) {
 		g_lingo->push(d);
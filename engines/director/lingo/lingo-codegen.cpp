@@ -162,31 +162,42 @@ Symbol *Lingo::lookupVar(const char *name, bool create, bool putInGlobalList) {
 		}
 	}
 
-	if (!_localvars || !_localvars->contains(name)) { // Create variable if it was not defined
-		// Check if it is a global symbol
-		if (_globalvars.contains(name) && _globalvars[name]->type == SYMBOL)
-			return _globalvars[name];
+	// Every lookup below hashes the name case-insensitively, so make sure
+	// each table is only searched once
+	const Common::String key(name);
 
-		if (!create)
-			return NULL;
+	if (_localvars) {
+		SymbolHash::iterator local = _localvars->find(key);
+		if (local != _localvars->end()) {
+			sym = local->_value;
 
-		sym = new Symbol;
-		sym->name = name;
-		sym->type = VOID;
-		sym->u.i = 0;
-
-		if (_localvars)
-			(*_localvars)[name] = sym;
+			if (sym->global)
+				sym = _globalvars[key];
 
-		if (putInGlobalList) {
-			sym->global = true;
-			_globalvars[name] = sym;
+			return sym;
 		}
-	} else {
-		sym = (*_localvars)[name];
+	}
 
-		if (sym->global)
-			sym = _globalvars[name];
+	// Check if it is a global symbol
+	SymbolHash::iterator global = _globalvars.find(key);
+	if (global != _globalvars.end() && global->_value->type == SYMBOL)
+		return global->_value;
+
+	if (!create)
+		return NULL;
+
+	// Create variable if it was not defined
+	sym = new Symbol;
+	sym->name = key;
+	sym->type = VOID;
+	sym->u.i = 0;
+
+	if (_localvars)
+		(*_localvars)[key] = sym;
+
+	if (putInGlobalList) {
+		sym->global = true;
+		_globalvars[key] = sym;
 	}
 
 	return sym;
@@ -213,6 +224,8 @@ void Lingo::define(Common::String &name, int start, int nargs, Common::String *p
 
 	debugC(1, kDebugLingoCompile, "define(\"%s\", %d, %d, %d)", name.c_str(), start, _currentScript->size() - 1, nargs);
 
+	_definitionCount++;
+
 	Symbol *sym = getHandler(name);
 	if (sym == NULL) { // Create variable if it was not defined
 		sym = new Symbol;
@@ -389,6 +402,7 @@ void Lingo::processIf(int elselabel, int endlabel) {
 
 void Lingo::codeFactory(Common::String &name) {
 	_currentFactory = name;
+	_definitionCount++;
 
 	Symbol *sym = new Symbol;
 
@@ -330,6 +330,8 @@ void Lingo::setTheSprite(Datum &id1, int field, Datum &d) {
 	if (!sprite)
 		return;
 
+	_vm->getCurrentScore()->markFrameDirty(_vm->getCurrentScore()->getCurrentFrame());
+
 	switch (field) {
 	case kTheCastNum:
 		if (_vm->getCurrentScore()->_castTypes.contains(d.u.i)) {
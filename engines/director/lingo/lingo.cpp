@@ -60,6 +60,8 @@ Lingo::Lingo(DirectorEngine *vm) : _vm(vm) {
 
 	_inFactory = false;
 
+	_definitionCount = 0;
+
 	_floatPrecision = 4;
 	_floatPrecisionFormat = "%.4f";
 
@@ -79,6 +81,8 @@ Lingo::Lingo(DirectorEngine *vm) : _vm(vm) {
 }
 
 Lingo::~Lingo() {
+	for (CompiledScriptHash::iterator it = _compiledScripts.begin(); it != _compiledScripts.end(); ++it)
+		delete it->_value;
 }
 
 const char *Lingo::findNextDefinition(const char *s) {
@@ -133,7 +137,9 @@ void Lingo::addCode(const char *code, ScriptType type, uint16 id) {
 	_linenumber = _colnumber = 1;
 	_hadError = false;
 
-	const char *begin, *end;
+	// The lexer depends on these, so only code compiled without them
+	// can be reused
+	const bool cacheable = !_immediateMode && _currentFactory.empty();
 
 	if (!strncmp(code, "menu:", 5)) {
 		debugC(1, kDebugLingoCompile, "Parsing menu");
@@ -142,8 +148,14 @@ void Lingo::addCode(const char *code, ScriptType type, uint16 id) {
 		return;
 	}
 
-	// macros and factories have conflicting grammar. Thus we ease life for the parser.
-	if ((begin = findNextDefinition(code))) {
+	const char *begin, *end;
+	CompiledScriptHash::iterator compiled = cacheable ? _compiledScripts.find(code) : _compiledScripts.end();
+
+	if (compiled != _compiledScripts.end()) {
+		debugC(2, kDebugLingoCompile, "Reusing compiled code");
+		*_currentScript = *compiled->_value;
+	} else if ((begin = findNextDefinition(code))) {
+		// macros and factories have conflicting grammar. Thus we ease life for the parser.
 		bool first = true;
 
 		while ((end = findNextDefinition(begin + 1))) {
@@ -183,9 +195,14 @@ void Lingo::addCode(const char *code, ScriptType type, uint16 id) {
 		debugC(1, kDebugLingoCompile, "Code chunk:\n#####\n%s#####", begin);
 		parse(begin);
 	} else {
+		const uint definitionCount = _definitionCount;
+
 		parse(code);
 
 		code1(STOP);
+
+		if (cacheable && !_hadError && definitionCount == _definitionCount)
+			_compiledScripts[code] = new ScriptData(*_currentScript);
 	}
 
 	_inFactory = false;
@@ -141,6 +141,7 @@ struct Builtin {
 };
 
 typedef Common::HashMap<int32, ScriptData *> ScriptHash;
+typedef Common::HashMap<Common::String, ScriptData *> CompiledScriptHash;
 typedef Common::Array<Datum> StackData;
 typedef Common::HashMap<Common::String, Symbol *, Common::IgnoreCase_Hash, Common::IgnoreCase_EqualTo> SymbolHash;
 typedef Common::HashMap<Common::String, Builtin *, Common::IgnoreCase_Hash, Common::IgnoreCase_EqualTo> BuiltinHash;
@@ -552,6 +553,15 @@ private:
 
 	ScriptHash _scripts[kMaxScriptType + 1];
 
+	/**
+	 * Compiled code of scripts that do not define handlers or factories,
+	 * keyed by their text. Movies tend to use the same short frame scripts
+	 * over and over, and compiling them again always gives the same code.
+	 */
+	CompiledScriptHash _compiledScripts;
+	// Incremented whenever compiling registers a handler or factory
+	uint _definitionCount;
+
 	SymbolHash _globalvars;
 	SymbolHash *_localvars;
 
@@ -85,6 +85,12 @@ Score::Score(DirectorEngine *vm) {
 	_stopPlay = false;
 	_stageColor = 0;
 
+	_frameCount = 0;
+	_frameDataIsBE = true;
+	_frameDeltas = nullptr;
+	_keyFrames = nullptr;
+	_frameCacheCounter = 0;
+
 	_loadedBitmaps = new Common::HashMap<int, BitmapCast *>();
 	_loadedText = new Common::HashMap<int, TextCast *>();
 	_loadedButtons = new Common::HashMap<int, ButtonCast *>();
@@ -293,6 +299,12 @@ Score::~Score() {
 	if (_movieArchive)
 		_movieArchive->close();
 
+	for (uint i = 0; i < _frameCache.size(); ++i)
+		delete _frameCache[i].frame;
+
+	free(_frameDeltas);
+	free(_keyFrames);
+
 	delete _font;
 	delete _labels;
 	delete _loadedStxts;
@@ -374,8 +386,14 @@ void Score::loadFrames(Common::SeekableSubReadStreamEndian &stream) {
 	uint16 channelSize;
 	uint16 channelOffset;
 
-	Frame *initial = new Frame(_vm);
-	_frames.push_back(initial);
+	// The first frame is always empty
+	_frameCount = 1;
+	_frameDataIsBE = stream.isBE();
+	_frameDeltaEnds.clear();
+	_frameDeltaEnds.push_back(0);
+
+	Common::MemoryWriteStreamDynamic deltas(DisposeAfterUse::NO);
+	Common::MemoryWriteStreamDynamic keyFrames(DisposeAfterUse::NO);
 
 	// This is a representation of the channelData. It gets overridden
 	// partically by channels, hence we keep it and read the score from left to right
@@ -383,13 +401,13 @@ void Score::loadFrames(Common::SeekableSubReadStreamEndian &stream) {
 	// TODO Merge it with shared cast
 	byte channelData[kChannelDataSize];
 	memset(channelData, 0, kChannelDataSize);
+	keyFrames.write(channelData, kChannelDataSize);
 
 	while (size != 0 && !stream.eos()) {
 		uint16 frameSize = stream.readUint16();
-		debugC(kDebugLoading, 8, "++++ score frame %d (frameSize %d) size %d", _frames.size(), frameSize, size);
+		debugC(kDebugLoading, 8, "++++ score frame %d (frameSize %d) size %d", _frameCount, frameSize, size);
 
 		if (frameSize > 0) {
-			Frame *frame = new Frame(_vm);
 			size -= frameSize;
 			frameSize -= 2;
 
@@ -407,21 +425,108 @@ void Score::loadFrames(Common::SeekableSubReadStreamEndian &stream) {
 
 				assert(channelOffset + channelSize < kChannelDataSize);
 				stream.read(&channelData[channelOffset], channelSize);
+
+				byte header[4];
+				WRITE_UINT16(header, channelOffset);
+				WRITE_UINT16(header + 2, channelSize);
+				deltas.write(header, sizeof(header));
+				deltas.write(&channelData[channelOffset], channelSize);
 			}
 
-			Common::MemoryReadStreamEndian *str = new Common::MemoryReadStreamEndian(channelData, ARRAYSIZE(channelData), stream.isBE());
-			// str->hexdump(str->size(), 32);
-			frame->readChannels(str);
-			delete str;
+			debugC(3, kDebugLoading, "Frame %d delta size: %d", _frameCount, deltas.size() - _frameDeltaEnds.back());
 
-			debugC(3, kDebugLoading, "Frame %d actionId: %d", _frames.size(), frame->_actionId);
+			_frameDeltaEnds.push_back(deltas.size());
+			if (_frameCount % kKeyFrameInterval == 0)
+				keyFrames.write(channelData, kChannelDataSize);
 
-			_frames.push_back(frame);
+			_frameCount++;
 		} else {
 			warning("zero sized frame!? exiting loop until we know what to do with the tags that follow.");
 			size = 0;
 		}
 	}
+
+	free(_frameDeltas);
+	free(_keyFrames);
+	_frameDeltas = deltas.getData();
+	_keyFrames = keyFrames.getData();
+}
+
+Frame *Score::getFrame(uint16 frameId) {
+	assert(frameId < _frameCount);
+
+	_frameCacheCounter++;
+
+	// The current frame and frames changed by Lingo must stay alive
+	int oldest = -1;
+	for (uint i = 0; i < _frameCache.size(); ++i) {
+		if (_frameCache[i].frameId == frameId) {
+			_frameCache[i].lastUse = _frameCacheCounter;
+			return _frameCache[i].frame;
+		}
+
+		if (_frameCache[i].dirty || _frameCache[i].frameId == _currentFrame)
+			continue;
+
+		if (oldest < 0 || _frameCache[i].lastUse < _frameCache[oldest].lastUse)
+			oldest = i;
+	}
+
+	CachedFrame entry;
+	entry.frameId = frameId;
+	entry.lastUse = _frameCacheCounter;
+	entry.dirty = false;
+	entry.frame = materializeFrame(frameId);
+
+	if (_frameCache.size() < kFrameCacheSize || oldest < 0) {
+		_frameCache.push_back(entry);
+	} else {
+		delete _frameCache[oldest].frame;
+		_frameCache[oldest] = entry;
+	}
+
+	return entry.frame;
+}
+
+void Score::markFrameDirty(uint16 frameId) {
+	for (uint i = 0; i < _frameCache.size(); ++i) {
+		if (_frameCache[i].frameId == frameId) {
+			_frameCache[i].dirty = true;
+			return;
+		}
+	}
+}
+
+Frame *Score::materializeFrame(uint16 frameId) {
+	debugC(4, kDebugLoading, "Building frame %d", frameId);
+
+	Frame *frame = new Frame(_vm);
+
+	if (frameId > 0) {
+		const uint keyFrame = frameId / kKeyFrameInterval;
+
+		byte channelData[kChannelDataSize];
+		memcpy(channelData, _keyFrames + keyFrame * kChannelDataSize, kChannelDataSize);
+
+		// Replay the channel updates of the frames following the key frame
+		const byte *delta = _frameDeltas + _frameDeltaEnds[keyFrame * kKeyFrameInterval];
+		const byte *end = _frameDeltas + _frameDeltaEnds[frameId];
+		while (delta < end) {
+			const uint16 offset = READ_UINT16(delta);
+			const uint16 deltaSize = READ_UINT16(delta + 2);
+			memcpy(&channelData[offset], delta + 4, deltaSize);
+			delta += 4 + deltaSize;
+		}
+
+		Common::MemoryReadStreamEndian str(channelData, ARRAYSIZE(channelData), _frameDataIsBE);
+		frame->readChannels(&str);
+
+		debugC(3, kDebugLoading, "Frame %d actionId: %d", frameId, frame->_actionId);
+	}
+
+	setSpriteCasts(frame);
+
+	return frame;
 }
 
 void Score::loadConfig(Common::SeekableSubReadStreamEndian &stream) {
@@ -489,43 +594,48 @@ void Score::loadCastDataVWCR(Common::SeekableSubReadStreamEndian &stream) {
 }
 
 void Score::setSpriteCasts() {
+	// Frames are built with their cast pointers set, so only the frames that
+	// already exist need to be updated
+	for (uint i = 0; i < _frameCache.size(); i++)
+		setSpriteCasts(_frameCache[i].frame);
+}
+
+void Score::setSpriteCasts(Frame *frame) {
 	// Set cast pointers to sprites
-	for (uint16 i = 0; i < _frames.size(); i++) {
-		for (uint16 j = 0; j < _frames[i]->_sprites.size(); j++) {
-			uint16 castId = _frames[i]->_sprites[j]->_castId;
-
-			if (_vm->getSharedScore() != nullptr && _vm->getSharedScore()->_loadedBitmaps->contains(castId)) {
-				_frames[i]->_sprites[j]->_bitmapCast = _vm->getSharedScore()->_loadedBitmaps->getVal(castId);
-			} else if (_loadedBitmaps->contains(castId)) {
-				_frames[i]->_sprites[j]->_bitmapCast = _loadedBitmaps->getVal(castId);
-			}
+	for (uint16 j = 0; j < frame->_sprites.size(); j++) {
+		uint16 castId = frame->_sprites[j]->_castId;
 
-			if (_vm->getSharedScore() != nullptr && _vm->getSharedScore()->_loadedButtons->contains(castId)) {
-				_frames[i]->_sprites[j]->_buttonCast = _vm->getSharedScore()->_loadedButtons->getVal(castId);
-				if (_frames[i]->_sprites[j]->_buttonCast->children.size() == 1) {
-					_frames[i]->_sprites[j]->_textCast =
-						_vm->getSharedScore()->_loadedText->getVal(_frames[i]->_sprites[j]->_buttonCast->children[0].index);
-				} else if (_frames[i]->_sprites[j]->_buttonCast->children.size() > 0) {
-					warning("Cast %d has too many children!", j);
-				}
-			} else if (_loadedButtons->contains(castId)) {
-				_frames[i]->_sprites[j]->_buttonCast = _loadedButtons->getVal(castId);
+		if (_vm->getSharedScore() != nullptr && _vm->getSharedScore()->_loadedBitmaps->contains(castId)) {
+			frame->_sprites[j]->_bitmapCast = _vm->getSharedScore()->_loadedBitmaps->getVal(castId);
+		} else if (_loadedBitmaps->contains(castId)) {
+			frame->_sprites[j]->_bitmapCast = _loadedBitmaps->getVal(castId);
+		}
+
+		if (_vm->getSharedScore() != nullptr && _vm->getSharedScore()->_loadedButtons->contains(castId)) {
+			frame->_sprites[j]->_buttonCast = _vm->getSharedScore()->_loadedButtons->getVal(castId);
+			if (frame->_sprites[j]->_buttonCast->children.size() == 1) {
+				frame->_sprites[j]->_textCast =
+					_vm->getSharedScore()->_loadedText->getVal(frame->_sprites[j]->_buttonCast->children[0].index);
+			} else if (frame->_sprites[j]->_buttonCast->children.size() > 0) {
+				warning("Cast %d has too many children!", j);
 			}
+		} else if (_loadedButtons->contains(castId)) {
+			frame->_sprites[j]->_buttonCast = _loadedButtons->getVal(castId);
+		}
 
-			//if (_loadedScripts->contains(castId))
-			//	_frames[i]->_sprites[j]->_bitmapCast = _loadedBitmaps->getVal(castId);
+		//if (_loadedScripts->contains(castId))
+		//	frame->_sprites[j]->_bitmapCast = _loadedBitmaps->getVal(castId);
 
-			if (_vm->getSharedScore() != nullptr && _vm->getSharedScore()->_loadedText->contains(castId)) {
-				_frames[i]->_sprites[j]->_textCast = _vm->getSharedScore()->_loadedText->getVal(castId);
-			} else if (_loadedText->contains(castId)) {
-				_frames[i]->_sprites[j]->_textCast = _loadedText->getVal(castId);
-			}
+		if (_vm->getSharedScore() != nullptr && _vm->getSharedScore()->_loadedText->contains(castId)) {
+			frame->_sprites[j]->_textCast = _vm->getSharedScore()->_loadedText->getVal(castId);
+		} else if (_loadedText->contains(castId)) {
+			frame->_sprites[j]->_textCast = _loadedText->getVal(castId);
+		}
 
-			if (_vm->getSharedScore() != nullptr && _vm->getSharedScore()->_loadedShapes->contains(castId)) {
-				_frames[i]->_sprites[j]->_shapeCast = _vm->getSharedScore()->_loadedShapes->getVal(castId);
-			} else if (_loadedShapes->contains(castId)) {
-				_frames[i]->_sprites[j]->_shapeCast = _loadedShapes->getVal(castId);
-			}
+		if (_vm->getSharedScore() != nullptr && _vm->getSharedScore()->_loadedShapes->contains(castId)) {
+			frame->_sprites[j]->_shapeCast = _vm->getSharedScore()->_loadedShapes->getVal(castId);
+		} else if (_loadedShapes->contains(castId)) {
+			frame->_sprites[j]->_shapeCast = _loadedShapes->getVal(castId);
 		}
 	}
 }
@@ -1184,13 +1294,13 @@ void Score::startLoop() {
 	_stopPlay = false;
 	_nextFrameTime = 0;
 
-	_frames[_currentFrame]->prepareFrame(this);
+	getFrame(_currentFrame)->prepareFrame(this);
 
-	while (!_stopPlay && _currentFrame < _frames.size()) {
+	while (!_stopPlay && _currentFrame < _frameCount) {
 		debugC(1, kDebugImages, "******************************  Current frame: %d", _currentFrame + 1);
 		update();
 
-		if (_currentFrame < _frames.size())
+		if (_currentFrame < _frameCount)
 			_vm->processEvents();
 	}
 }
@@ -1202,7 +1312,7 @@ void Score::update() {
 	_surface->clear();
 	_surface->copyFrom(*_trailSurface);
 
-	_lingo->executeImmediateScripts(_frames[_currentFrame]);
+	_lingo->executeImmediateScripts(getFrame(_currentFrame));
 
 	// Enter and exit from previous frame (Director 4)
 	_lingo->processEvent(kEventEnterFrame);
@@ -1230,13 +1340,14 @@ void Score::update() {
 
 	_vm->_skipFrameAdvance = false;
 
-	if (_currentFrame >= _frames.size())
+	if (_currentFrame >= _frameCount)
 		return;
 
-	_frames[_currentFrame]->prepareFrame(this);
+	Frame *frame = getFrame(_currentFrame);
+	frame->prepareFrame(this);
 	// Stage is drawn between the prepareFrame and enterFrame events (Lingo in a Nutshell)
 
-	byte tempo = _frames[_currentFrame]->_tempo;
+	byte tempo = frame->_tempo;
 
 	if (tempo) {
 		if (tempo > 161) {
@@ -1273,12 +1384,13 @@ void Score::update() {
 }
 
 Sprite *Score::getSpriteById(uint16 id) {
-	if (_currentFrame >= _frames.size() || id >= _frames[_currentFrame]->_sprites.size()) {
+	if (_currentFrame >= _frameCount || id >= getFrame(_currentFrame)->_sprites.size()) {
 		warning("Score::getSpriteById(%d): out of bounds. frame: %d", id, _currentFrame);
 		return nullptr;
 	}
-	if (_frames[_currentFrame]->_sprites[id]) {
-		return _frames[_currentFrame]->_sprites[id];
+	Frame *frame = getFrame(_currentFrame);
+	if (frame->_sprites[id]) {
+		return frame->_sprites[id];
 	} else {
 		warning("Sprite on frame %d width id %d not found", _currentFrame, id);
 		return nullptr;
@@ -81,6 +81,13 @@ public:
 	uint16 getCurrentFrame() { return _currentFrame; }
 	Common::String getMacName() const { return _macName; }
 	Sprite *getSpriteById(uint16 id);
+	uint16 getFrameCount() const { return _frameCount; }
+	Frame *getFrame(uint16 frameId);
+	/**
+	 * Keeps the given frame from being evicted from the frame cache, since
+	 * its sprites were changed at runtime and can't be rebuilt from the score
+	 */
+	void markFrameDirty(uint16 frameId);
 	void setSpriteCasts();
 	void loadSpriteImages(bool isSharedCast);
 	void copyCastStxts();
@@ -99,6 +106,8 @@ private:
 	void readVersion(uint32 rid);
 	void loadPalette(Common::SeekableSubReadStreamEndian &stream);
 	void loadFrames(Common::SeekableSubReadStreamEndian &stream);
+	Frame *materializeFrame(uint16 frameId);
+	void setSpriteCasts(Frame *frame);
 	void loadLabels(Common::SeekableSubReadStreamEndian &stream);
 	void loadActions(Common::SeekableSubReadStreamEndian &stream);
 	void loadScriptText(Common::SeekableSubReadStreamEndian &stream);
@@ -111,7 +120,6 @@ private:
 	bool processImmediateFrameScript(Common::String s, int id);
 
 public:
-	Common::Array<Frame *> _frames;
 	Common::HashMap<int, CastType> _castTypes;
 	Common::HashMap<uint16, CastInfo *> _castsInfo;
 	Common::HashMap<Common::String, int> _castsNames;
@@ -138,6 +146,37 @@ public:
 	Common::HashMap<int, const Stxt *> *_loadedStxts;
 
 private:
+	enum {
+		kKeyFrameInterval = 16,
+		kFrameCacheSize = 8
+	};
+
+	struct CachedFrame {
+		uint16 frameId;
+		uint32 lastUse;
+		bool dirty;
+		Frame *frame;
+	};
+
+	/**
+	 * The score is kept in the delta-encoded form it is stored in, as a list
+	 * of channel updates per frame, and Frames are only built when they are
+	 * needed. Updates are stored as a native-endian offset and size followed
+	 * by the channel data.
+	 */
+	uint16 _frameCount;
+	bool _frameDataIsBE;
+	byte *_frameDeltas;
+	// Offset of the end of every frame's updates in _frameDeltas
+	Common::Array<uint32> _frameDeltaEnds;
+	// Complete channel data after every kKeyFrameInterval-th frame, so that
+	// building a frame never replays more than kKeyFrameInterval frames
+	byte *_keyFrames;
+	// Recently used frames. Frames changed by Lingo are never evicted, so
+	// the cache can grow past kFrameCacheSize.
+	Common::Array<CachedFrame> _frameCache;
+	uint32 _frameCacheCounter;
+
 	uint16 _versionMinor;
 	uint16 _versionMajor;
 	Common::String _macName;
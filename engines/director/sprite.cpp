@@ -115,14 +115,7 @@ Sprite::Sprite(const Sprite &sprite) {
 }
 
 Sprite::~Sprite() {
-	if (_bitmapCast) 
-		delete _bitmapCast;
-	if (_shapeCast) 
-		delete _shapeCast;
-	if (_textCast) 
-		delete _textCast;
-	if (_buttonCast) 
-		delete _buttonCast;
+	// The casts belong to the Score they were loaded by
 }
 
 } // End of namespace Director
@@ -54,6 +54,7 @@
 #include "sci/video/seq_decoder.h"
 #ifdef ENABLE_SCI32
 #include "common/memstream.h"
+#include "sci/graphics/celobj32.h"
 #include "sci/graphics/frameout.h"
 #include "sci/graphics/paint32.h"
 #include "sci/graphics/palette32.h"
@@ -150,6 +151,7 @@ Console::Console(SciEngine *engine) : GUI::Debugger(),
 	registerCmd("vpi",                WRAP_METHOD(Console, cmdVisiblePlaneItemList));	// alias
 	registerCmd("saved_bits",         WRAP_METHOD(Console, cmdSavedBits));
 	registerCmd("show_saved_bits",    WRAP_METHOD(Console, cmdShowSavedBits));
+	registerCmd("bench_cel",          WRAP_METHOD(Console, cmdBenchCel));
 	// Segments
 	registerCmd("segment_table",		WRAP_METHOD(Console, cmdPrintSegmentTable));
 	registerCmd("segtable",			WRAP_METHOD(Console, cmdPrintSegmentTable));	// alias
@@ -163,6 +165,7 @@ Console::Console(SciEngine *engine) : GUI::Debugger(),
 	registerCmd("gc_reachable",		WRAP_METHOD(Console, cmdGCShowReachable));
 	registerCmd("gc_freeable",		WRAP_METHOD(Console, cmdGCShowFreeable));
 	registerCmd("gc_normalize",		WRAP_METHOD(Console, cmdGCNormalize));
+	registerCmd("gc_stats",			WRAP_METHOD(Console, cmdGCStats));
 	// Music/SFX
 	registerCmd("songlib",			WRAP_METHOD(Console, cmdSongLib));
 	registerCmd("songinfo",			WRAP_METHOD(Console, cmdSongInfo));
@@ -367,6 +370,7 @@ bool Console::cmdHelp(int argc, const char **argv) {
 	debugPrintf(" visible_plane_items / vpi - Shows a list of all items for a plane in the visible draw list (SCI2+)\n");
 	debugPrintf(" saved_bits - List saved bits on the hunk\n");
 	debugPrintf(" show_saved_bits - Display saved bits\n");
+	debugPrintf(" bench_cel - Measures the time needed to draw a cel (SCI2+)\n");
 	debugPrintf("\n");
 	debugPrintf("Segments:\n");
 	debugPrintf(" segment_table / segtable - Lists all segments\n");
@@ -379,6 +383,7 @@ bool Console::cmdHelp(int argc, const char **argv) {
 	debugPrintf(" gc_reachable - Lists all addresses directly reachable from a given memory object\n");
 	debugPrintf(" gc_freeable - Lists all addresses freeable in a given segment\n");
 	debugPrintf(" gc_normalize - Prints the \"normal\" address of a given address\n");
+	debugPrintf(" gc_stats - Shows pause and reclaim statistics of the garbage collector\n");
 	debugPrintf("\n");
 	debugPrintf("Music/SFX:\n");
 	debugPrintf(" songlib - Shows the song library\n");
@@ -2179,6 +2184,88 @@ bool Console::cmdSavedBits(int argc, const char **argv) {
 	return true;
 }
 
+bool Console::cmdBenchCel(int argc, const char **argv) {
+	if (argc < 4) {
+		debugPrintf("Measures the time needed to draw a cel from a view resource, unscaled,\n");
+		debugPrintf("mirrored, upscaled and downscaled, into an offscreen buffer (SCI2+)\n");
+		debugPrintf("Usage: %s <resourceId> <loopNr> <celNr> [iterations]\n", argv[0]);
+		return true;
+	}
+
+#ifdef ENABLE_SCI32
+	if (!_engine->_gfxFrameout) {
+		debugPrintf("This SCI version does not use the SCI32 renderer\n");
+		return true;
+	}
+
+	const GuiResourceId viewId = atoi(argv[1]);
+	const int16 loopNo = atoi(argv[2]);
+	const int16 celNo = atoi(argv[3]);
+	const int iterations = argc > 4 ? MAX(atoi(argv[4]), 1) : 100;
+
+	if (!_engine->getResMan()->testResource(ResourceId(kResourceTypeView, viewId))) {
+		debugPrintf("Resource view.%d not found\n", viewId);
+		return true;
+	}
+
+	if (loopNo >= CelObjView::getNumLoops(viewId) || celNo >= CelObjView::getNumCels(viewId, loopNo)) {
+		debugPrintf("Invalid loop or cel number\n");
+		return true;
+	}
+
+	CelObjView celObj(viewId, loopNo, celNo);
+
+	const Buffer &screen = _engine->_gfxFrameout->getCurrentBuffer();
+	Buffer target;
+	target.create(screen.w, screen.h, Graphics::PixelFormat::createFormatCLUT8());
+	const Common::Rect screenRect(target.w, target.h);
+
+	struct BenchCase {
+		const char *name;
+		bool mirrorX;
+		Ratio scale;
+	};
+
+	const BenchCase cases[] = {
+		{ "unscaled", false, Ratio() },
+		{ "mirrored", true, Ratio() },
+		{ "upscaled 2x", false, Ratio(2, 1) },
+		{ "downscaled 1/2", false, Ratio(1, 2) }
+	};
+
+	debugPrintf("view.%d loop %d cel %d (%dx%d, %s, %s), %d iterations:\n",
+				viewId, loopNo, celNo, celObj._width, celObj._height,
+				celObj._compressionType == kCelCompressionNone ? "uncompressed" : "compressed",
+				celObj._transparent ? "transparent" : "opaque", iterations);
+
+	for (int i = 0; i < ARRAYSIZE(cases); ++i) {
+		const BenchCase &benchCase = cases[i];
+
+		Common::Rect targetRect(celObj._width, celObj._height);
+		mulru(targetRect, benchCase.scale, benchCase.scale, 0);
+		targetRect.clip(screenRect);
+		if (targetRect.isEmpty()) {
+			continue;
+		}
+
+		const uint32 startTime = g_system->getMillis();
+		for (int j = 0; j < iterations; ++j) {
+			celObj.draw(target, targetRect, Common::Point(0, 0), benchCase.mirrorX, benchCase.scale, benchCase.scale);
+		}
+		const uint32 duration = g_system->getMillis() - startTime;
+
+		debugPrintf(" %-15s %dx%d: %u ms total, %u us per draw\n", benchCase.name,
+					targetRect.width(), targetRect.height(), duration,
+					duration * 1000 / iterations);
+	}
+
+	target.free();
+#else
+	debugPrintf("SCI32 isn't included in this compiled executable\n");
+#endif
+	return true;
+}
+
 bool Console::cmdShowSavedBits(int argc, const char **argv) {
 	if (argc < 2) {
 		debugPrintf("Display saved bits.\n");
@@ -2819,6 +2906,19 @@ bool Console::cmdGCNormalize(int argc, const char **argv) {
 	return true;
 }
 
+bool Console::cmdGCStats(int argc, const char **argv) {
+	const EngineState *s = _engine->_gamestate;
+	const GCStatistics &stats = s->gcStats;
+
+	debugPrintf("Collections: %u\n", stats.collections);
+	debugPrintf("Mark pause: last %u ms, max %u ms\n", stats.lastPause, stats.maxPause);
+	debugPrintf("Sweep step pause: max %u ms\n", stats.maxStepPause);
+	debugPrintf("Freed since last collection: %u entries, %u bytes\n", stats.lastFreedEntries, stats.lastFreedBytes);
+	debugPrintf("Freed in total: %u entries, %u bytes\n", stats.totalFreedEntries, stats.totalFreedBytes);
+	debugPrintf("Entries waiting to be freed: %u\n", s->gcPendingFree.size());
+	return true;
+}
+
 bool Console::cmdVMVarlist(int argc, const char **argv) {
 	EngineState *s = _engine->_gamestate;
 	const char *varnames[] = {"global", "local", "temp", "param"};
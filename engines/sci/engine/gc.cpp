@@ -22,6 +22,7 @@
 
 #include "sci/engine/gc.h"
 #include "common/array.h"
+#include "common/system.h"
 #include "sci/graphics/ports.h"
 
 #ifdef ENABLE_SCI32
@@ -179,11 +180,46 @@ AddrSet *findAllActiveReferences(EngineState *s) {
 	return normalizeAddresses(s->_segMan, wm._map);
 }
 
-void run_gc(EngineState *s) {
+/**
+ * Returns whether unreachable entries of the given segment type may be freed
+ * lazily by incremental gc steps. These table segments are allocated once and
+ * live until the segment manager is reset, so a pending address cannot end
+ * up pointing into an unrelated segment before it is swept.
+ */
+static bool isSweptIncrementally(SegmentType type) {
+	switch (type) {
+	case SEG_TYPE_LISTS:
+	case SEG_TYPE_NODES:
+	case SEG_TYPE_HUNK:
+#ifdef ENABLE_SCI32
+	case SEG_TYPE_ARRAY:
+#endif
+		return true;
+	default:
+		return false;
+	}
+}
+
+static void freeUnreachable(EngineState *s, SegmentObj *mobj, reg_t addr) {
+	GCStatistics &stats = s->gcStats;
+	const uint32 size = mobj->getAllocatedSize(addr);
+
+	mobj->freeAtAddress(s->_segMan, addr);
+	debugC(kDebugLevelGC, "[GC] Deallocating %04x:%04x", PRINT_REG(addr));
+
+	stats.lastFreedEntries++;
+	stats.lastFreedBytes += size;
+	stats.totalFreedEntries++;
+	stats.totalFreedBytes += size;
+}
+
+static void collectGarbage(EngineState *s, bool incremental) {
 	SegManager *segMan = s->_segMan;
+	GCStatistics &stats = s->gcStats;
+	const uint32 startTime = g_system->getMillis();
 
 	// Some debug stuff
-	debugC(kDebugLevelGC, "[GC] Running...");
+	debugC(kDebugLevelGC, "[GC] Running%s...", incremental ? " (incremental)" : "");
 #ifdef GC_DEBUG_CODE
 	const char *segnames[SEG_TYPE_MAX + 1];
 	int segcount[SEG_TYPE_MAX + 1];
@@ -191,6 +227,14 @@ void run_gc(EngineState *s) {
 	memset(segcount, 0, sizeof(segcount));
 #endif
 
+	// Anything left over from the previous cycle would be found unreachable
+	// again below, so finish sweeping it first
+	while (!s->gcPendingFree.empty())
+		run_gc_step(s);
+
+	stats.lastFreedEntries = 0;
+	stats.lastFreedBytes = 0;
+
 	// Compute the set of all segments references currently in use.
 	AddrSet *activeRefs = findAllActiveReferences(s);
 
@@ -201,20 +245,24 @@ void run_gc(EngineState *s) {
 		SegmentObj *mobj = heap[seg];
 
 		if (mobj != NULL) {
-#ifdef GC_DEBUG_CODE
 			const SegmentType type = mobj->getType();
+#ifdef GC_DEBUG_CODE
 			segnames[type] = segmentTypeNames[type];
 #endif
+			const bool deferred = incremental && isSweptIncrementally(type);
 
 			// Get a list of all deallocatable objects in this segment,
-			// then free any which are not referenced from somewhere.
+			// then free (or queue for freeing) any which are not
+			// referenced from somewhere.
 			const Common::Array<reg_t> tmp = mobj->listAllDeallocatable(seg);
 			for (Common::Array<reg_t>::const_iterator it = tmp.begin(); it != tmp.end(); ++it) {
 				const reg_t addr = *it;
 				if (!activeRefs->contains(addr)) {
 					// Not found -> we can free it
-					mobj->freeAtAddress(segMan, addr);
-					debugC(kDebugLevelGC, "[GC] Deallocating %04x:%04x", PRINT_REG(addr));
+					if (deferred)
+						s->gcPendingFree.push_back(addr);
+					else
+						freeUnreachable(s, mobj, addr);
 #ifdef GC_DEBUG_CODE
 					segcount[type]++;
 #endif
@@ -226,6 +274,13 @@ void run_gc(EngineState *s) {
 
 	delete activeRefs;
 
+	const uint32 pause = g_system->getMillis() - startTime;
+	stats.collections++;
+	stats.lastPause = pause;
+	stats.maxPause = MAX(stats.maxPause, pause);
+
+	debugC(kDebugLevelGC, "[GC] Done in %u ms, %u entries freed, %u queued", pause, stats.lastFreedEntries, s->gcPendingFree.size());
+
 #ifdef GC_DEBUG_CODE
 	// Output debug summary of garbage collection
 	debugC(kDebugLevelGC, "[GC] Summary:");
@@ -235,4 +290,32 @@ void run_gc(EngineState *s) {
 #endif
 }
 
+void run_gc(EngineState *s) {
+	collectGarbage(s, false);
+}
+
+void run_gc_incremental(EngineState *s) {
+	collectGarbage(s, true);
+}
+
+void run_gc_step(EngineState *s) {
+	if (s->gcPendingFree.empty())
+		return;
+
+	const uint32 startTime = g_system->getMillis();
+	SegManager *segMan = s->_segMan;
+
+	for (uint i = 0; i < GC_SWEEP_SLICE && !s->gcPendingFree.empty(); i++) {
+		const reg_t addr = s->gcPendingFree.back();
+		s->gcPendingFree.pop_back();
+
+		SegmentObj *mobj = segMan->getSegmentObj(addr.getSegment());
+		if (mobj && mobj->isValidOffset(addr.getOffset()))
+			freeUnreachable(s, mobj, addr);
+	}
+
+	GCStatistics &stats = s->gcStats;
+	stats.maxStepPause = MAX(stats.maxStepPause, g_system->getMillis() - startTime);
+}
+
 } // End of namespace Sci
@@ -55,6 +55,21 @@ AddrSet *findAllActiveReferences(EngineState *s);
  */
 void run_gc(EngineState *s);
 
+/**
+ * Runs the mark phase of garbage collection on the current system state.
+ * Unreachable list, node, hunk and array entries are queued in
+ * EngineState::gcPendingFree and freed by subsequent calls to run_gc_step,
+ * everything else is freed immediately.
+ * @param s The state in which we should gc
+ */
+void run_gc_incremental(EngineState *s);
+
+/**
+ * Frees at most GC_SWEEP_SLICE entries queued by run_gc_incremental
+ * @param s The state in which we should gc
+ */
+void run_gc_step(EngineState *s);
+
 struct WorklistManager {
 	Common::Array<reg_t> _worklist;
 	AddrSet _map;	// used for 2 contains() calls, inside push() and run_gc()
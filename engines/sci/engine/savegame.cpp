@@ -1333,6 +1333,7 @@ void gamestate_restore(EngineState *s, Common::SeekableReadStream *fh) {
 	s->_segMan->reconstructClones();
 	s->initGlobals();
 	s->gcCountDown = GC_INTERVAL - 1;
+	s->gcPendingFree.clear();
 
 	// Time state:
 	s->lastWaitTime = g_system->getMillis();
@@ -123,6 +123,14 @@ public:
 	 */
 	virtual void freeAtAddress(SegManager *segMan, reg_t sub_addr) {}
 
+	/**
+	 * Returns the number of bytes of memory associated with the specified
+	 * address, i.e. the amount reclaimed by freeAtAddress.
+	 * Used by the garbage collector for its statistics.
+	 * @param sub_addr		address (within the given segment) to measure
+	 */
+	virtual uint32 getAllocatedSize(reg_t sub_addr) const { return 0; }
+
 	/**
 	 * Iterates over and reports all addresses within the segment.
 	 * Used by the garbage collector.
@@ -306,6 +314,10 @@ public:
 		return tmp;
 	}
 
+	virtual uint32 getAllocatedSize(reg_t sub_addr) const {
+		return isValidEntry(sub_addr.getOffset()) ? sizeof(T) : 0;
+	}
+
 	uint size() const { return _table.size(); }
 
 	T &at(uint index) { return *_table[index].data; }
@@ -377,6 +389,12 @@ struct HunkTable : public SegmentObjTable<Hunk> {
 		freeEntry(sub_addr.getOffset());
 	}
 
+	virtual uint32 getAllocatedSize(reg_t sub_addr) const {
+		if (!isValidEntry(sub_addr.getOffset()))
+			return 0;
+		return sizeof(Hunk) + at(sub_addr.getOffset()).size;
+	}
+
 	virtual void saveLoadWithSerializer(Common::Serializer &ser);
 };
 
@@ -405,6 +423,9 @@ public:
 		const reg_t r = make_reg(segId, 0);
 		return Common::Array<reg_t>(&r, 1);
 	}
+	virtual uint32 getAllocatedSize(reg_t sub_addr) const {
+		return _size;
+	}
 
 	virtual void saveLoadWithSerializer(Common::Serializer &ser);
 };
@@ -903,6 +924,12 @@ struct ArrayTable : public SegmentObjTable<SciArray> {
 
 	virtual Common::Array<reg_t> listAllOutgoingReferences(reg_t object) const;
 
+	virtual uint32 getAllocatedSize(reg_t sub_addr) const {
+		if (!isValidEntry(sub_addr.getOffset()))
+			return 0;
+		return sizeof(SciArray) + at(sub_addr.getOffset()).byteSize();
+	}
+
 	void saveLoadWithSerializer(Common::Serializer &ser);
 	SegmentRef dereference(reg_t pointer);
 };
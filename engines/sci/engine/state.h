@@ -57,6 +57,31 @@ enum AbortGameState {
 	kAbortQuitGame = 3
 };
 
+/**
+ * Pause and reclaim statistics of the garbage collector, shown by the
+ * gc_stats debugger command.
+ */
+struct GCStatistics {
+	uint32 collections; /**< Number of completed mark phases */
+	uint32 lastPause; /**< Duration of the last mark phase, in ms */
+	uint32 maxPause; /**< Longest mark phase, in ms */
+	uint32 maxStepPause; /**< Longest incremental sweep step, in ms */
+	uint32 lastFreedEntries; /**< Entries freed since the last mark phase */
+	uint32 lastFreedBytes; /**< Bytes freed since the last mark phase */
+	uint32 totalFreedEntries; /**< Entries freed since the engine started */
+	uint32 totalFreedBytes; /**< Bytes freed since the engine started */
+
+	GCStatistics() :
+		collections(0),
+		lastPause(0),
+		maxPause(0),
+		maxStepPause(0),
+		lastFreedEntries(0),
+		lastFreedBytes(0),
+		totalFreedEntries(0),
+		totalFreedBytes(0) {}
+};
+
 // We assume that scripts give us savegameId 0->99 for creating a new save slot
 //  and savegameId 100->199 for existing save slots. Refer to kfile.cpp
 enum {
@@ -189,6 +214,8 @@ public:
 	void shrinkStackToBase();
 
 	int gcCountDown; /**< Number of kernel calls until next gc */
+	Common::Array<reg_t> gcPendingFree; /**< Unreachable table entries still to be freed by incremental gc steps */
+	GCStatistics gcStats; /**< Statistics of the garbage collector */
 
 	MessageState *_msgState;
 
@@ -878,7 +878,9 @@ void run_vm(EngineState *s) {
 			// Run the garbage collector, if needed
 			if (s->gcCountDown-- <= 0) {
 				s->gcCountDown = s->scriptGCInterval;
-				run_gc(s);
+				run_gc_incremental(s);
+			} else if (!s->gcPendingFree.empty()) {
+				run_gc_step(s);
 			}
 
 			// Call kernel function
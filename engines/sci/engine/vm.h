@@ -184,6 +184,11 @@ enum {
 	GC_INTERVAL = 0x8000
 };
 
+/** Maximum number of unreachable entries freed by a single incremental gc step */
+enum {
+	GC_SWEEP_SLICE = 32
+};
+
 enum SciOpcodes {
 	op_bnot     = 0x00,	// 000
 	op_add      = 0x01,	// 001
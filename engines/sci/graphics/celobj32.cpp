@@ -109,6 +109,7 @@ struct SCALER_NoScale {
 	const int16 _lastIndex;
 	const int16 _sourceX;
 	const int16 _sourceY;
+	byte _buffer[kCelScalerTableSize];
 
 	SCALER_NoScale(const CelObj &celObj, const int16 maxWidth, const Common::Point &scaledPosition) :
 	_row(nullptr),
@@ -135,13 +136,22 @@ struct SCALER_NoScale {
 		}
 	}
 
-	inline byte read() {
-		assert(_row != _rowEdge);
-
+	/**
+	 * Returns the next `width` source pixels in target order. Unflipped rows
+	 * are returned directly from the reader without copying.
+	 */
+	inline const byte *readRow(const int16 width) {
 		if (FLIP) {
-			return *_row--;
+			assert(_row - width >= _rowEdge);
+			for (int16 x = 0; x < width; ++x) {
+				_buffer[x] = *_row--;
+			}
+			return _buffer;
 		} else {
-			return *_row++;
+			assert(_row + width <= _rowEdge);
+			const byte *row = _row;
+			_row += width;
+			return row;
 		}
 	}
 };
@@ -155,9 +165,20 @@ struct SCALER_Scale {
 	const byte *_row;
 	READER _reader;
 	int16 _x;
+	int16 _y;
 	static int16 _valuesX[kCelScalerTableSize];
 	static int16 _valuesY[kCelScalerTableSize];
 
+	/**
+	 * The most recently scaled row, and the source row, first target column,
+	 * and width it was built from. Upscaled cels read the same source row for
+	 * several consecutive target rows, which can then reuse this buffer.
+	 */
+	byte _buffer[kCelScalerTableSize];
+	int16 _bufferY;
+	int16 _bufferX;
+	int16 _bufferWidth;
+
 	SCALER_Scale(const CelObj &celObj, const Common::Rect &targetRect, const Common::Point &scaledPosition, const Ratio scaleX, const Ratio scaleY) :
 	_row(nullptr),
 #ifndef NDEBUG
@@ -167,7 +188,10 @@ struct SCALER_Scale {
 	// The maximum width of the scaled object may not be as wide as the source
 	// data it requires if downscaling, so just always make the reader
 	// decompress an entire line of source data when scaling
-	_reader(celObj, celObj._width) {
+	_reader(celObj, celObj._width),
+	_bufferY(-1),
+	_bufferX(-1),
+	_bufferWidth(0) {
 #ifndef NDEBUG
 		assert(_minX <= _maxX);
 #endif
@@ -232,14 +256,31 @@ struct SCALER_Scale {
 	}
 
 	inline void setTarget(const int16 x, const int16 y) {
-		_row = _reader.getRow(_valuesY[y]);
+		_y = _valuesY[y];
+		_row = _reader.getRow(_y);
 		_x = x;
 		assert(_x >= _minX && _x <= _maxX);
 	}
 
-	inline byte read() {
-		assert(_x >= _minX && _x <= _maxX);
-		return _row[_valuesX[_x++]];
+	/**
+	 * Returns the next `width` scaled pixels in target order.
+	 */
+	inline const byte *readRow(const int16 width) {
+		assert(_x >= _minX && _x + width - 1 <= _maxX);
+
+		if (_y != _bufferY || _x != _bufferX || width != _bufferWidth) {
+			const int16 *valueX = _valuesX + _x;
+			for (int16 x = 0; x < width; ++x) {
+				_buffer[x] = _row[valueX[x]];
+			}
+
+			_bufferY = _y;
+			_bufferX = _x;
+			_bufferWidth = width;
+		}
+
+		_x += width;
+		return _buffer;
 	}
 };
 
@@ -379,9 +420,24 @@ public:
  * remapping data.
  */
 struct MAPPER_NoMD {
-	inline void draw(byte *target, const byte pixel, const uint8 skipColor) const {
-		if (pixel != skipColor) {
-			*target = pixel;
+	inline void drawRow(byte *target, const byte *source, const int16 width, const uint8 skipColor) const {
+		// Opaque pixels in cels come in long runs, so copy each run at once
+		// instead of testing and storing one pixel at a time
+		const byte *const sourceEnd = source + width;
+		while (source != sourceEnd) {
+			while (source != sourceEnd && *source == skipColor) {
+				++source;
+				++target;
+			}
+
+			const byte *const run = source;
+			while (source != sourceEnd && *source != skipColor) {
+				++source;
+			}
+
+			const int16 runLength = source - run;
+			memcpy(target, run, runLength);
+			target += runLength;
 		}
 	}
 };
@@ -391,8 +447,8 @@ struct MAPPER_NoMD {
  * no remapping data.
  */
 struct MAPPER_NoMDNoSkip {
-	inline void draw(byte *target, const byte pixel, const uint8) const {
-		*target = pixel;
+	inline void drawRow(byte *target, const byte *source, const int16 width, const uint8) const {
+		memcpy(target, source, width);
 	}
 };
 
@@ -401,14 +457,18 @@ struct MAPPER_NoMDNoSkip {
  * remapping data, and remapping enabled.
  */
 struct MAPPER_Map {
-	inline void draw(byte *target, const byte pixel, const uint8 skipColor) const {
-		if (pixel != skipColor) {
-			// For some reason, SSCI never checks if the source pixel is *above*
-			// the range of remaps, so we do not either.
-			if (pixel < g_sci->_gfxRemap32->getStartColor()) {
-				*target = pixel;
-			} else if (g_sci->_gfxRemap32->remapEnabled(pixel)) {
-				*target = g_sci->_gfxRemap32->remapColor(pixel, *target);
+	inline void drawRow(byte *target, const byte *source, const int16 width, const uint8 skipColor) const {
+		const uint8 startColor = g_sci->_gfxRemap32->getStartColor();
+		for (int16 x = 0; x < width; ++x, ++target, ++source) {
+			const byte pixel = *source;
+			if (pixel != skipColor) {
+				// For some reason, SSCI never checks if the source pixel is
+				// *above* the range of remaps, so we do not either.
+				if (pixel < startColor) {
+					*target = pixel;
+				} else if (g_sci->_gfxRemap32->remapEnabled(pixel)) {
+					*target = g_sci->_gfxRemap32->remapColor(pixel, *target);
+				}
 			}
 		}
 	}
@@ -419,11 +479,14 @@ struct MAPPER_Map {
  * remapping data, and remapping disabled.
  */
 struct MAPPER_NoMap {
-	inline void draw(byte *target, const byte pixel, const uint8 skipColor) const {
+	inline void drawRow(byte *target, const byte *source, const int16 width, const uint8 skipColor) const {
 		// For some reason, SSCI never checks if the source pixel is *above* the
 		// range of remaps, so we do not either.
-		if (pixel != skipColor && pixel < g_sci->_gfxRemap32->getStartColor()) {
-			*target = pixel;
+		const uint8 startColor = g_sci->_gfxRemap32->getStartColor();
+		for (int16 x = 0; x < width; ++x, ++target, ++source) {
+			if (*source != skipColor && *source < startColor) {
+				*target = *source;
+			}
 		}
 	}
 };
@@ -671,12 +734,8 @@ struct RENDERER {
 			}
 
 			_scaler.setTarget(targetRect.left, targetRect.top + y);
-
-			for (int16 x = 0; x < targetWidth; ++x) {
-				_mapper.draw(targetPixel++, _scaler.read(), _skipColor);
-			}
-
-			targetPixel += skipStride;
+			_mapper.drawRow(targetPixel, _scaler.readRow(targetWidth), targetWidth, _skipColor);
+			targetPixel += targetWidth + skipStride;
 		}
 	}
 };
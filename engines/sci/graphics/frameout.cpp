@@ -68,7 +68,6 @@ GfxFrameout::GfxFrameout(SegManager *segMan, GfxPalette32 *palette, GfxTransitio
 	_transitions(transitions),
 	_throttleState(0),
 	_remapOccurred(false),
-	_overdrawThreshold(0),
 	_throttleKernelFrameOut(true),
 	_palMorphIsOn(false),
 	_lastScreenUpdateTick(0) {
@@ -131,6 +130,7 @@ void GfxFrameout::clear() {
 	_planes.clear();
 	_visiblePlanes.clear();
 	_showList.clear();
+	_showRegion.clear();
 }
 
 bool GfxFrameout::detectHiRes() const {
@@ -581,91 +581,6 @@ void GfxFrameout::resetHardware() {
 }
 #endif
 
-/**
- * Determines the parts of `middleRect` that aren't overlapped by `showRect`,
- * optimised for contiguous memory writes.
- *
- * `middleRect` is modified directly to extend into the upper and lower rects.
- *
- * @returns -1 if `middleRect` and `showRect` have no intersection, or the
- * number of returned parts (in `outRects`) otherwise. (In particular, this
- * returns 0 if `middleRect` is contained in `showRect`.)
- */
-int splitRectsForRender(Common::Rect &middleRect, const Common::Rect &showRect, Common::Rect(&outRects)[2]) {
-	if (!middleRect.intersects(showRect)) {
-		return -1;
-	}
-
-	const int16 minLeft = MIN(middleRect.left, showRect.left);
-	const int16 maxRight = MAX(middleRect.right, showRect.right);
-
-	int16 upperLeft, upperTop, upperRight, upperMaxTop;
-	if (middleRect.top < showRect.top) {
-		upperLeft = middleRect.left;
-		upperTop = middleRect.top;
-		upperRight = middleRect.right;
-		upperMaxTop = showRect.top;
-	}
-	else {
-		upperLeft = showRect.left;
-		upperTop = showRect.top;
-		upperRight = showRect.right;
-		upperMaxTop = middleRect.top;
-	}
-
-	int16 lowerLeft, lowerRight, lowerBottom, lowerMinBottom;
-	if (middleRect.bottom > showRect.bottom) {
-		lowerLeft = middleRect.left;
-		lowerRight = middleRect.right;
-		lowerBottom = middleRect.bottom;
-		lowerMinBottom = showRect.bottom;
-	} else {
-		lowerLeft = showRect.left;
-		lowerRight = showRect.right;
-		lowerBottom = showRect.bottom;
-		lowerMinBottom = middleRect.bottom;
-	}
-
-	int splitCount = 0;
-	middleRect.left = minLeft;
-	middleRect.top = upperMaxTop;
-	middleRect.right = maxRight;
-	middleRect.bottom = lowerMinBottom;
-
-	if (upperTop != upperMaxTop) {
-		Common::Rect &upperRect = outRects[0];
-		upperRect.left = upperLeft;
-		upperRect.top = upperTop;
-		upperRect.right = upperRight;
-		upperRect.bottom = upperMaxTop;
-
-		// Merge upper rect into middle rect if possible
-		if (upperRect.left == middleRect.left && upperRect.right == middleRect.right) {
-			middleRect.top = upperRect.top;
-		} else {
-			++splitCount;
-		}
-	}
-
-	if (lowerBottom != lowerMinBottom) {
-		Common::Rect &lowerRect = outRects[splitCount];
-		lowerRect.left = lowerLeft;
-		lowerRect.top = lowerMinBottom;
-		lowerRect.right = lowerRight;
-		lowerRect.bottom = lowerBottom;
-
-		// Merge lower rect into middle rect if possible
-		if (lowerRect.left == middleRect.left && lowerRect.right == middleRect.right) {
-			middleRect.bottom = lowerRect.bottom;
-		} else {
-			++splitCount;
-		}
-	}
-
-	assert(splitCount <= 2);
-	return splitCount;
-}
-
 // The third rectangle parameter is only ever passed by VMD code
 void GfxFrameout::calcLists(ScreenItemListList &drawLists, EraseListList &eraseLists, const Common::Rect &eraseRect) {
 	RectList eraseList;
@@ -915,7 +830,7 @@ void GfxFrameout::drawEraseList(const RectList &eraseList, const Plane &plane) {
 
 	const RectList::size_type eraseListSize = eraseList.size();
 	for (RectList::size_type i = 0; i < eraseListSize; ++i) {
-		mergeToShowList(*eraseList[i], _showList, _overdrawThreshold);
+		_showRegion.add(*eraseList[i]);
 		_currentBuffer.fillRect(*eraseList[i], plane._back);
 	}
 }
@@ -924,72 +839,30 @@ void GfxFrameout::drawScreenItemList(const DrawList &screenItemList) {
 	const DrawList::size_type drawListSize = screenItemList.size();
 	for (DrawList::size_type i = 0; i < drawListSize; ++i) {
 		const DrawItem &drawItem = *screenItemList[i];
-		mergeToShowList(drawItem.rect, _showList, _overdrawThreshold);
+		_showRegion.add(drawItem.rect);
 		const ScreenItem &screenItem = *drawItem.screenItem;
 		CelObj &celObj = *screenItem._celObj;
 		celObj.draw(_currentBuffer, screenItem, drawItem.rect, screenItem._mirrorX ^ celObj._mirrorX);
 	}
 }
 
-void GfxFrameout::mergeToShowList(const Common::Rect &drawRect, RectList &showList, const int overdrawThreshold) {
-	RectList mergeList;
-	Common::Rect merged;
-	mergeList.add(drawRect);
-
-	for (RectList::size_type i = 0; i < mergeList.size(); ++i) {
-		bool didMerge = false;
-		const Common::Rect &r1 = *mergeList[i];
-		if (!r1.isEmpty()) {
-			for (RectList::size_type j = 0; j < showList.size(); ++j) {
-				const Common::Rect &r2 = *showList[j];
-				if (!r2.isEmpty()) {
-					merged = r1;
-					merged.extend(r2);
-
-					int difference = merged.width() * merged.height();
-					difference -= r1.width() * r1.height();
-					difference -= r2.width() * r2.height();
-					if (r1.intersects(r2)) {
-						const Common::Rect overlap = r1.findIntersectingRect(r2);
-						difference += overlap.width() * overlap.height();
-					}
-
-					if (difference <= overdrawThreshold) {
-						mergeList.erase_at(i);
-						showList.erase_at(j);
-						mergeList.add(merged);
-						didMerge = true;
-						break;
-					} else {
-						Common::Rect outRects[2];
-						int splitCount = splitRectsForRender(*mergeList[i], *showList[j], outRects);
-						if (splitCount != -1) {
-							mergeList.add(*mergeList[i]);
-							mergeList.erase_at(i);
-							showList.erase_at(j);
-							didMerge = true;
-							while (splitCount--) {
-								mergeList.add(outRects[splitCount]);
-							}
-							break;
-						}
-					}
-				}
-			}
-
-			if (didMerge) {
-				showList.pack();
-			}
-		}
+void GfxFrameout::mergeShowRegion() {
+	if (_showRegion.isEmpty()) {
+		return;
 	}
 
-	mergeList.pack();
-	for (RectList::size_type i = 0; i < mergeList.size(); ++i) {
-		showList.add(*mergeList[i]);
+	if (_showList.size() + _showRegion.getRectCount() > _showList.max_size()) {
+		_showList.add(_showRegion.getBounds());
+	} else {
+		_showRegion.addRectsTo(_showList);
 	}
+
+	_showRegion.clear();
 }
 
 void GfxFrameout::showBits() {
+	mergeShowRegion();
+
 	if (!_showList.size()) {
 		updateScreen();
 		return;
@@ -323,12 +323,17 @@ private:
 	RectList _showList;
 
 	/**
-	 * The amount of extra overdraw that is acceptable when merging two show
-	 * list rectangles together into a single larger rectangle.
+	 * The portions of the internal screen buffer that were drawn to by
+	 * `drawEraseList` and `drawScreenItemList` and have not been added to
+	 * `_showList` yet.
 	 *
-	 * @note This field is on `GraphicsMgr.screen` in SSCI.
+	 * @note SSCI merged every drawn rect directly into the show list, only
+	 * combining two rects when this caused at most `overdrawThreshold` (always
+	 * zero) extra pixels to be drawn. Accumulating a Region instead gives the
+	 * same exact coverage without comparing every drawn rect against the
+	 * whole show list.
 	 */
-	int _overdrawThreshold;
+	Region _showRegion;
 
 	/**
 	 * The list of planes that are currently drawn to the hardware display
@@ -363,11 +368,11 @@ private:
 	void drawScreenItemList(const DrawList &screenItemList);
 
 	/**
-	 * Adds a new rectangle to the list of regions to write out to the hardware.
-	 * The provided rect may be merged into an existing rectangle to reduce the
-	 * number of blit operations.
+	 * Moves the rects of `_showRegion` to the list of regions to write out to
+	 * the hardware. If the region is too fragmented to fit into the list, its
+	 * bounding rect is written out instead.
 	 */
-	void mergeToShowList(const Common::Rect &drawRect, RectList &showList, const int overdrawThreshold);
+	void mergeShowRegion();
 
 	/**
 	 * Sends all dirty rects from the internal frame buffer to the backend, then
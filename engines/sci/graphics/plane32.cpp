@@ -262,6 +262,14 @@ void Plane::deleteAllPics() {
 #pragma mark -
 #pragma mark Plane - Rendering
 
+static void addToRegion(const RectList &rectList, Region &region) {
+	for (RectList::const_iterator rect = rectList.begin(); rect != rectList.end(); ++rect) {
+		if (*rect != nullptr) {
+			region.add(**rect);
+		}
+	}
+}
+
 void Plane::breakDrawListByPlanes(DrawList &drawList, const PlaneList &planeList) const {
 	const int nextPlaneIndex = planeList.findIndexByObject(_object) + 1;
 	const PlaneList::size_type planeCount = planeList.size();
@@ -318,6 +326,13 @@ void Plane::calcLists(Plane &visiblePlane, const PlaneList &planeList, DrawList
 	const ScreenItemList::size_type screenItemCount = _screenItemList.size();
 	const ScreenItemList::size_type visiblePlaneItemCount = visiblePlane._screenItemList.size();
 
+	// Erase rects only need to be kept from overlapping when remapping is
+	// active, since only then are they merged instead of just added
+	Region eraseRegion;
+	if (g_sci->_gfxRemap32->getRemapCount()) {
+		addToRegion(eraseList, eraseRegion);
+	}
+
 	for (ScreenItemList::size_type i = 0; i < screenItemCount; ++i) {
 		// Items can be added to ScreenItemList and we don't want to process
 		// those new items, but the list also can grow smaller, so we need to
@@ -356,7 +371,7 @@ void Plane::calcLists(Plane &visiblePlane, const PlaneList &planeList, DrawList
 				!visibleItemScreenRect.isEmpty()
 			) {
 				if (g_sci->_gfxRemap32->getRemapCount()) {
-					mergeToRectList(visibleItemScreenRect, eraseList);
+					mergeToRectList(visibleItemScreenRect, eraseList, eraseRegion);
 				} else {
 					eraseList.add(visibleItemScreenRect);
 				}
@@ -375,7 +390,7 @@ void Plane::calcLists(Plane &visiblePlane, const PlaneList &planeList, DrawList
 			if(!itemScreenRect.isEmpty()) {
 				if (g_sci->_gfxRemap32->getRemapCount()) {
 					drawList.add(item, itemScreenRect);
-					mergeToRectList(itemScreenRect, eraseList);
+					mergeToRectList(itemScreenRect, eraseList, eraseRegion);
 				} else {
 					drawList.add(item, itemScreenRect);
 				}
@@ -393,10 +408,10 @@ void Plane::calcLists(Plane &visiblePlane, const PlaneList &planeList, DrawList
 					// ...add item to draw list, and old rect to erase list...
 					if (!itemScreenRect.isEmpty()) {
 						drawList.add(item, itemScreenRect);
-						mergeToRectList(itemScreenRect, eraseList);
+						mergeToRectList(itemScreenRect, eraseList, eraseRegion);
 					}
 					if (visibleItem != nullptr && !visibleItemScreenRect.isEmpty()) {
-						mergeToRectList(visibleItemScreenRect, eraseList);
+						mergeToRectList(visibleItemScreenRect, eraseList, eraseRegion);
 					}
 				} else {
 					// ...otherwise, add bounding box of old+new to erase list,
@@ -405,7 +420,7 @@ void Plane::calcLists(Plane &visiblePlane, const PlaneList &planeList, DrawList
 					extendedScreenRect.extend(itemScreenRect);
 
 					drawList.add(item, itemScreenRect);
-					mergeToRectList(extendedScreenRect, eraseList);
+					mergeToRectList(extendedScreenRect, eraseList, eraseRegion);
 				}
 			} else {
 				// If no active remaps, just add item to draw list and old rect
@@ -587,11 +602,14 @@ void Plane::filterDownEraseRects(DrawList &drawList, RectList &eraseList, RectLi
 			}
 		}
 	} else {
+		Region eraseRegion;
+		addToRegion(eraseList, eraseRegion);
+
 		for (RectList::size_type i = 0; i < higherEraseCount; ++i) {
 			Common::Rect r = *higherEraseList[i];
 			if (r.intersects(_screenRect)) {
 				r.clip(_screenRect);
-				mergeToRectList(r, eraseList);
+				mergeToRectList(r, eraseList, eraseRegion);
 
 				const ScreenItemList::size_type screenItemCount = _screenItemList.size();
 				for (ScreenItemList::size_type j = 0; j < screenItemCount; ++j) {
@@ -687,42 +705,11 @@ void Plane::mergeToDrawList(const ScreenItemList::size_type index, const Common:
 	}
 }
 
-void Plane::mergeToRectList(const Common::Rect &rect, RectList &eraseList) const {
-	RectList mergeList;
-	Common::Rect r;
-	mergeList.add(rect);
-
-	for (RectList::size_type i = 0; i < mergeList.size(); ++i) {
-		r = *mergeList[i];
-
-		const RectList::size_type eraseCount = eraseList.size();
-		for (RectList::size_type j = 0; j < eraseCount; ++j) {
-			const Common::Rect &eraseRect = *eraseList[j];
-			if (eraseRect.contains(r)) {
-				mergeList.erase_at(i);
-				break;
-			}
-
-			Common::Rect outRects[4];
-			int splitCount = splitRects(r, eraseRect, outRects);
-			if (splitCount != -1) {
-				while (splitCount--) {
-					mergeList.add(outRects[splitCount]);
-				}
-
-				mergeList.erase_at(i);
-
-				// proceed to the next rect
-				r = *mergeList[++i];
-			}
-		}
-	}
-
-	mergeList.pack();
-
-	for (RectList::size_type i = 0; i < mergeList.size(); ++i) {
-		eraseList.add(*mergeList[i]);
-	}
+void Plane::mergeToRectList(const Common::Rect &rect, RectList &eraseList, Region &eraseRegion) const {
+	Region mergeRegion(rect);
+	mergeRegion.subtract(eraseRegion);
+	mergeRegion.addRectsTo(eraseList);
+	eraseRegion.add(mergeRegion);
 }
 
 void Plane::redrawAll(Plane *visiblePlane, const PlaneList &planeList, DrawList &drawList, RectList &eraseList) {
@@ -28,6 +28,7 @@
 #include "sci/engine/vm_types.h"
 #include "sci/graphics/helpers.h"
 #include "sci/graphics/lists32.h"
+#include "sci/graphics/region32.h"
 #include "sci/graphics/screen_item32.h"
 
 namespace Sci {
@@ -377,10 +378,11 @@ private:
 	void mergeToDrawList(const DrawList::size_type index, const Common::Rect &rect, DrawList &drawList) const;
 
 	/**
-	 * Merges `rect` with an existing rect in `eraseList`, if possible.
-	 * Otherwise, adds the rect as a new entry to `eraseList`.
+	 * Adds the parts of `rect` that are not already in `eraseList` as new
+	 * entries to `eraseList`. `eraseRegion` must cover the same area as
+	 * `eraseList` and is updated to include `rect`.
 	 */
-	void mergeToRectList(const Common::Rect &rect, RectList &eraseList) const;
+	void mergeToRectList(const Common::Rect &rect, RectList &eraseList, Region &eraseRegion) const;
 
 public:
 	/**
@@ -0,0 +1,284 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+
+#include "sci/graphics/region32.h"
+
+namespace Sci {
+
+enum {
+	kRegionCoordinateMax = 0x7FFF
+};
+
+void Region::add(const Common::Rect &rect) {
+	if (rect.isEmpty()) {
+		return;
+	}
+
+	if (isEmpty()) {
+		const Span span = { rect.left, rect.right };
+		_spans.push_back(span);
+		const Band band = { rect.top, rect.bottom, 0, 1 };
+		_bands.push_back(band);
+		return;
+	}
+
+	combine(Region(rect), kOperationUnion);
+}
+
+bool Region::contains(const Common::Rect &rect) const {
+	if (rect.isEmpty()) {
+		return true;
+	}
+
+	int16 y = rect.top;
+	for (BandList::const_iterator band = _bands.begin(); band != _bands.end(); ++band) {
+		if (band->bottom <= y) {
+			continue;
+		}
+
+		// Bands are coalesced, so a gap between bands or a band without a
+		// single span covering the rect means some pixels are missing
+		if (band->top > y) {
+			return false;
+		}
+
+		bool covered = false;
+		for (uint i = band->firstSpan; i < band->firstSpan + band->numSpans; ++i) {
+			if (_spans[i].left <= rect.left && _spans[i].right >= rect.right) {
+				covered = true;
+				break;
+			}
+		}
+
+		if (!covered) {
+			return false;
+		}
+
+		y = band->bottom;
+		if (y >= rect.bottom) {
+			return true;
+		}
+	}
+
+	return false;
+}
+
+bool Region::intersects(const Common::Rect &rect) const {
+	if (rect.isEmpty()) {
+		return false;
+	}
+
+	for (BandList::const_iterator band = _bands.begin(); band != _bands.end(); ++band) {
+		if (band->bottom <= rect.top) {
+			continue;
+		}
+
+		if (band->top >= rect.bottom) {
+			break;
+		}
+
+		for (uint i = band->firstSpan; i < band->firstSpan + band->numSpans; ++i) {
+			if (_spans[i].right > rect.left && _spans[i].left < rect.right) {
+				return true;
+			}
+		}
+	}
+
+	return false;
+}
+
+Common::Rect Region::getBounds() const {
+	if (isEmpty()) {
+		return Common::Rect();
+	}
+
+	Common::Rect bounds;
+	bounds.top = _bands.front().top;
+	bounds.bottom = _bands.back().bottom;
+	bounds.left = kRegionCoordinateMax;
+	bounds.right = -kRegionCoordinateMax;
+	for (BandList::const_iterator band = _bands.begin(); band != _bands.end(); ++band) {
+		bounds.left = MIN(bounds.left, _spans[band->firstSpan].left);
+		bounds.right = MAX(bounds.right, _spans[band->firstSpan + band->numSpans - 1].right);
+	}
+
+	return bounds;
+}
+
+uint32 Region::getArea() const {
+	uint32 area = 0;
+	for (BandList::const_iterator band = _bands.begin(); band != _bands.end(); ++band) {
+		uint32 width = 0;
+		for (uint i = band->firstSpan; i < band->firstSpan + band->numSpans; ++i) {
+			width += _spans[i].right - _spans[i].left;
+		}
+		area += width * (band->bottom - band->top);
+	}
+
+	return area;
+}
+
+void Region::combine(const Region &other, const Operation operation) {
+	const BandList &bandsA = _bands;
+	const BandList &bandsB = other._bands;
+
+	if (bandsA.empty() && bandsB.empty()) {
+		return;
+	}
+
+	Region result;
+	uint indexA = 0;
+	uint indexB = 0;
+
+	int16 y;
+	if (bandsA.empty()) {
+		y = bandsB.front().top;
+	} else if (bandsB.empty()) {
+		y = bandsA.front().top;
+	} else {
+		y = MIN(bandsA.front().top, bandsB.front().top);
+	}
+
+	// Walk down both regions at once, stopping at every band edge of either
+	// region, so that the spans of each region are constant between stops
+	while (indexA < bandsA.size() || indexB < bandsB.size()) {
+		const Band *bandA = indexA < bandsA.size() ? &bandsA[indexA] : nullptr;
+		const Band *bandB = indexB < bandsB.size() ? &bandsB[indexB] : nullptr;
+		const bool inA = bandA != nullptr && bandA->top <= y;
+		const bool inB = bandB != nullptr && bandB->top <= y;
+
+		int16 nextY = kRegionCoordinateMax;
+		if (bandA != nullptr) {
+			nextY = MIN(nextY, inA ? bandA->bottom : bandA->top);
+		}
+		if (bandB != nullptr) {
+			nextY = MIN(nextY, inB ? bandB->bottom : bandB->top);
+		}
+
+		if (inA || inB) {
+			const uint firstSpan = result._spans.size();
+			combineSpans(inA ? &_spans[bandA->firstSpan] : nullptr, inA ? bandA->numSpans : 0,
+						 inB ? &other._spans[bandB->firstSpan] : nullptr, inB ? bandB->numSpans : 0,
+						 operation, result._spans);
+			result.appendBand(y, nextY, firstSpan);
+		}
+
+		y = nextY;
+		if (bandA != nullptr && bandA->bottom == y) {
+			++indexA;
+		}
+		if (bandB != nullptr && bandB->bottom == y) {
+			++indexB;
+		}
+	}
+
+	_bands = result._bands;
+	_spans = result._spans;
+}
+
+void Region::combineSpans(const Span *a, const uint numA, const Span *b, const uint numB, const Operation operation, SpanList &out) {
+	// Every span contributes a left and a right edge; walking the edges of
+	// both lists in order while toggling the inside state of each list gives
+	// the inside state of the result between any two edges
+	const uint numEdgesA = numA * 2;
+	const uint numEdgesB = numB * 2;
+	uint edgeA = 0;
+	uint edgeB = 0;
+	bool inA = false;
+	bool inB = false;
+	bool inResult = false;
+	int16 left = 0;
+
+	while (edgeA < numEdgesA || edgeB < numEdgesB) {
+		int16 x = kRegionCoordinateMax;
+		if (edgeA < numEdgesA) {
+			x = MIN(x, (edgeA & 1) ? a[edgeA / 2].right : a[edgeA / 2].left);
+		}
+		if (edgeB < numEdgesB) {
+			x = MIN(x, (edgeB & 1) ? b[edgeB / 2].right : b[edgeB / 2].left);
+		}
+
+		while (edgeA < numEdgesA && ((edgeA & 1) ? a[edgeA / 2].right : a[edgeA / 2].left) == x) {
+			inA = !inA;
+			++edgeA;
+		}
+		while (edgeB < numEdgesB && ((edgeB & 1) ? b[edgeB / 2].right : b[edgeB / 2].left) == x) {
+			inB = !inB;
+			++edgeB;
+		}
+
+		bool inside;
+		switch (operation) {
+		case kOperationUnion:
+			inside = inA || inB;
+			break;
+		case kOperationSubtract:
+			inside = inA && !inB;
+			break;
+		case kOperationIntersect:
+		default:
+			inside = inA && inB;
+			break;
+		}
+
+		if (inside != inResult) {
+			if (inside) {
+				left = x;
+			} else {
+				const Span span = { left, x };
+				out.push_back(span);
+			}
+			inResult = inside;
+		}
+	}
+}
+
+void Region::appendBand(const int16 top, const int16 bottom, const uint firstSpan) {
+	const uint numSpans = _spans.size() - firstSpan;
+	if (numSpans == 0) {
+		return;
+	}
+
+	if (!_bands.empty()) {
+		Band &last = _bands.back();
+		if (last.bottom == top && last.numSpans == numSpans) {
+			bool same = true;
+			for (uint i = 0; i < numSpans; ++i) {
+				if (!(_spans[last.firstSpan + i] == _spans[firstSpan + i])) {
+					same = false;
+					break;
+				}
+			}
+
+			if (same) {
+				last.bottom = bottom;
+				_spans.resize(firstSpan);
+				return;
+			}
+		}
+	}
+
+	const Band band = { top, bottom, firstSpan, numSpans };
+	_bands.push_back(band);
+}
+
+} // End of namespace Sci
@@ -0,0 +1,201 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+
+#ifndef SCI_GRAPHICS_REGION32_H
+#define SCI_GRAPHICS_REGION32_H
+
+#include "common/array.h"
+#include "common/rect.h"
+
+namespace Sci {
+
+/**
+ * A Region is an arbitrary set of pixels, stored as a list of horizontal
+ * bands sorted from top to bottom. Every band holds a sorted list of disjoint
+ * spans, and vertically adjacent bands with identical spans are always
+ * coalesced, so the rectangles making up a Region never overlap and there are
+ * as few of them as the band representation allows.
+ *
+ * Combining two regions costs time proportional to the number of bands and
+ * spans in both regions, independent of how many rectangles were added to
+ * build them. Regions are used by the renderer to accumulate dirty areas
+ * without comparing every new rectangle against every old one.
+ */
+class Region {
+public:
+	Region() {}
+	explicit Region(const Common::Rect &rect) {
+		add(rect);
+	}
+
+	/**
+	 * Returns true if the region contains no pixels.
+	 */
+	inline bool isEmpty() const {
+		return _bands.empty();
+	}
+
+	/**
+	 * Removes all pixels from the region.
+	 */
+	void clear() {
+		_bands.clear();
+		_spans.clear();
+	}
+
+	/**
+	 * Adds the given rect to the region.
+	 */
+	void add(const Common::Rect &rect);
+
+	/**
+	 * Adds the given region to the region.
+	 */
+	void add(const Region &other) {
+		combine(other, kOperationUnion);
+	}
+
+	/**
+	 * Removes the given rect from the region.
+	 */
+	void subtract(const Common::Rect &rect) {
+		if (!rect.isEmpty() && !isEmpty()) {
+			combine(Region(rect), kOperationSubtract);
+		}
+	}
+
+	/**
+	 * Removes the given region from the region.
+	 */
+	void subtract(const Region &other) {
+		if (!other.isEmpty() && !isEmpty()) {
+			combine(other, kOperationSubtract);
+		}
+	}
+
+	/**
+	 * Removes all pixels that are outside of the given rect.
+	 */
+	void intersect(const Common::Rect &rect) {
+		combine(Region(rect), kOperationIntersect);
+	}
+
+	/**
+	 * Removes all pixels that are outside of the given region.
+	 */
+	void intersect(const Region &other) {
+		combine(other, kOperationIntersect);
+	}
+
+	/**
+	 * Returns true if every pixel of the given rect is in the region.
+	 */
+	bool contains(const Common::Rect &rect) const;
+
+	/**
+	 * Returns true if any pixel of the given rect is in the region.
+	 */
+	bool intersects(const Common::Rect &rect) const;
+
+	/**
+	 * Returns the smallest rect containing the entire region.
+	 */
+	Common::Rect getBounds() const;
+
+	/**
+	 * Returns the number of pixels in the region.
+	 */
+	uint32 getArea() const;
+
+	/**
+	 * Returns the number of non-overlapping rects making up the region.
+	 */
+	inline uint getRectCount() const {
+		return _spans.size();
+	}
+
+	/**
+	 * Adds the non-overlapping rects making up the region, from top to bottom
+	 * and left to right, to the given list. The list must provide
+	 * `add(const Common::Rect &)`.
+	 */
+	template<typename LIST>
+	void addRectsTo(LIST &list) const {
+		for (BandList::const_iterator band = _bands.begin(); band != _bands.end(); ++band) {
+			for (uint i = band->firstSpan; i < band->firstSpan + band->numSpans; ++i) {
+				list.add(Common::Rect(_spans[i].left, band->top, _spans[i].right, band->bottom));
+			}
+		}
+	}
+
+private:
+	enum Operation {
+		kOperationUnion,
+		kOperationSubtract,
+		kOperationIntersect
+	};
+
+	struct Span {
+		int16 left;
+		int16 right;
+
+		inline bool operator==(const Span &other) const {
+			return left == other.left && right == other.right;
+		}
+	};
+
+	struct Band {
+		int16 top;
+		int16 bottom;
+		uint firstSpan;
+		uint numSpans;
+	};
+
+	typedef Common::Array<Band> BandList;
+	typedef Common::Array<Span> SpanList;
+
+	BandList _bands;
+	SpanList _spans;
+
+	/**
+	 * Replaces this region with the result of applying the given operation to
+	 * it and `other`.
+	 */
+	void combine(const Region &other, const Operation operation);
+
+	/**
+	 * Appends the result of applying the given operation to two sorted lists
+	 * of spans to `out`, merging touching spans.
+	 */
+	static void combineSpans(const Span *a, const uint numA, const Span *b, const uint numB, const Operation operation, SpanList &out);
+
+	/**
+	 * Appends a band below all existing bands, extending the last band
+	 * instead if it is adjacent and has the same spans. The spans of the new
+	 * band must already be at the end of `_spans`, starting at `firstSpan`.
+	 */
+	void appendBand(const int16 top, const int16 bottom, const uint firstSpan);
+};
+
+} // End of namespace Sci
+
+#endif
@@ -122,10 +122,17 @@ VideoPlayer::EventFlags VideoPlayer::playUntilEvent(const EventFlags flags, cons
 	// activating a video stop flag
 	_eventMan->flushEvents();
 
+	_decoder->setDecodeAheadCount(kDecodeAheadFrameCount);
 	_decoder->start();
 
 	EventFlags stopFlag = kEventFlagNone;
 	for (;;) {
+		// Decoding upcoming frames while waiting for the current frame to
+		// expire keeps slow frames (e.g. key frames) from delaying playback
+		if (!_decoder->needsUpdate()) {
+			_decoder->decodeAhead();
+		}
+
 		g_sci->sleep(MIN(_decoder->getTimeToNextFrame(), maxSleepMs));
 
 		const Graphics::Surface *nextFrame = nullptr;
@@ -79,6 +79,14 @@ public:
 	virtual ~VideoPlayer() {}
 
 protected:
+	enum {
+		/**
+		 * The maximum number of frames to decode while waiting for the
+		 * current frame to expire.
+		 */
+		kDecodeAheadFrameCount = 2
+	};
+
 	EventManager *_eventMan;
 
 	/**
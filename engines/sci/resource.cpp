@@ -208,18 +208,22 @@ Resource::Resource(ResourceManager *resMan, ResourceId id) : SciSpan<const byte>
 	_source = nullptr;
 	_header = nullptr;
 	_headerSize = 0;
+	_isMapped = false;
 }
 
 Resource::~Resource() {
-	delete[] _data;
+	if (!_isMapped)
+		delete[] _data;
 	delete[] _header;
 	if (_source && _source->getSourceType() == kSourcePatch)
 		delete _source;
 }
 
 void Resource::unalloc() {
-	delete[] _data;
+	if (!_isMapped)
+		delete[] _data;
 	_data = nullptr;
+	_isMapped = false;
 	_status = kResStatusNoMalloc;
 }
 
@@ -380,9 +384,21 @@ Common::SeekableReadStream *ResourceManager::getVolumeFile(ResourceSource *sourc
 	}
 	// adding a new file
 	file = new Common::File;
-	if (file->open(filename)) {
-		if (_volumeFiles.size() == MAX_OPENED_VOLUMES) {
-			it = --_volumeFiles.end();
+	if (file->openMapped(filename)) {
+		// Memory mapped volumes do not hold a file handle open, and
+		// uncompressed resources may refer to their contents, so only
+		// volumes that are read through a file handle are ever closed
+		uint numUnmappedVolumes = 0;
+		for (it = _volumeFiles.begin(); it != _volumeFiles.end(); ++it) {
+			if (!(*it)->getMappedData())
+				++numUnmappedVolumes;
+		}
+
+		if (numUnmappedVolumes == MAX_OPENED_VOLUMES) {
+			it = _volumeFiles.end();
+			do {
+				--it;
+			} while ((*it)->getMappedData());
 			delete *it;
 			_volumeFiles.erase(it);
 		}
@@ -412,6 +428,16 @@ void ResourceManager::disposeVolumeFileStream(Common::SeekableReadStream *fileSt
 	// deleted from _volumeFiles
 }
 
+const byte *ResourceManager::getMappedVolumeData(const Common::SeekableReadStream *fileStream) const {
+	for (Common::List<Common::File *>::const_iterator it = _volumeFiles.begin(); it != _volumeFiles.end(); ++it) {
+		if (*it == fileStream) {
+			return (*it)->getMappedData();
+		}
+	}
+
+	return nullptr;
+}
+
 void ResourceManager::loadResource(Resource *res) {
 	res->_source->loadResource(this, res);
 }
@@ -594,7 +620,7 @@ void ResourceSource::loadResource(ResourceManager *resMan, Resource *res) {
 
 	fileStream->seek(res->_fileOffset, SEEK_SET);
 
-	int error = res->decompress(resMan->getVolVersion(), fileStream);
+	int error = res->decompress(resMan->getVolVersion(), fileStream, resMan->getMappedVolumeData(fileStream));
 	if (error) {
 		warning("Error %d occurred while reading %s from resource file %s: %s",
 				error, res->_id.toString().c_str(), res->getResourceLocation().c_str(),
@@ -2218,7 +2244,7 @@ int Resource::readResourceInfo(ResVersion volVersion, Common::SeekableReadStream
 	return (compression == kCompUnknown) ? SCI_ERROR_UNKNOWN_COMPRESSION : SCI_ERROR_NONE;
 }
 
-int Resource::decompress(ResVersion volVersion, Common::SeekableReadStream *file) {
+int Resource::decompress(ResVersion volVersion, Common::SeekableReadStream *file, const byte *mappedVolume) {
 	int errorNum;
 	uint32 szPacked = 0;
 	ResourceCompression compression = kCompUnknown;
@@ -2228,6 +2254,17 @@ int Resource::decompress(ResVersion volVersion, Common::SeekableReadStream *file
 	if (errorNum)
 		return errorNum;
 
+	// Uncompressed resources in a memory mapped volume are used in place
+	// instead of being copied out of the volume
+	if (mappedVolume && compression == kCompNone && szPacked == _size &&
+		file->pos() + _size <= (uint32)file->size()) {
+		_data = mappedVolume + file->pos();
+		_isMapped = true;
+		_status = kResStatusAllocated;
+		validateAudioSize();
+		return SCI_ERROR_NONE;
+	}
+
 	// getting a decompressor
 	Decompressor *dec = NULL;
 	switch (compression) {
@@ -2263,26 +2300,30 @@ int Resource::decompress(ResVersion volVersion, Common::SeekableReadStream *file
 	if (errorNum) {
 		unalloc();
 	} else {
-		// At least Lighthouse puts sound effects in RESSCI.00n/RESSCI.PAT
-		// instead of using a RESOURCE.SFX
-		if (getType() == kResourceTypeAudio) {
-			const uint8 headerSize = ptr[1];
-			if (headerSize < 11) {
-				error("Unexpected audio header size for %s: should be >= 11, but got %d", _id.toString().c_str(), headerSize);
-			}
-			const uint32 audioSize = READ_LE_UINT32(ptr + 9);
-			const uint32 calculatedTotalSize = audioSize + headerSize + kResourceHeaderSize;
-			if (calculatedTotalSize != _size) {
-				warning("Unexpected audio file size: the size of %s in %s is %d, but the volume says it should be %d", _id.toString().c_str(), _source->getLocationName().c_str(), calculatedTotalSize, _size);
-			}
-			_size = MIN(_size - kResourceHeaderSize, headerSize + audioSize);
-		}
+		validateAudioSize();
 	}
 
 	delete dec;
 	return errorNum;
 }
 
+void Resource::validateAudioSize() {
+	// At least Lighthouse puts sound effects in RESSCI.00n/RESSCI.PAT
+	// instead of using a RESOURCE.SFX
+	if (getType() == kResourceTypeAudio) {
+		const uint8 headerSize = _data[1];
+		if (headerSize < 11) {
+			error("Unexpected audio header size for %s: should be >= 11, but got %d", _id.toString().c_str(), headerSize);
+		}
+		const uint32 audioSize = READ_LE_UINT32(_data + 9);
+		const uint32 calculatedTotalSize = audioSize + headerSize + kResourceHeaderSize;
+		if (calculatedTotalSize != _size) {
+			warning("Unexpected audio file size: the size of %s in %s is %d, but the volume says it should be %d", _id.toString().c_str(), _source->getLocationName().c_str(), calculatedTotalSize, _size);
+		}
+		_size = MIN(_size - kResourceHeaderSize, headerSize + audioSize);
+	}
+}
+
 ResourceCompression ResourceManager::getViewCompression() {
 	int viewsTested = 0;
 
@@ -299,13 +299,31 @@ protected:
 	ResourceSource *_source;
 	ResourceManager *_resMan;
 
+	/**
+	 * If true, the resource data points into a memory mapped volume file
+	 * instead of being owned by the resource.
+	 */
+	bool _isMapped;
+
 	bool loadPatch(Common::SeekableReadStream *file);
 	bool loadFromPatchFile();
 	bool loadFromWaveFile(Common::SeekableReadStream *file);
 	bool loadFromAudioVolumeSCI1(Common::SeekableReadStream *file);
 	bool loadFromAudioVolumeSCI11(Common::SeekableReadStream *file);
-	int decompress(ResVersion volVersion, Common::SeekableReadStream *file);
+	/**
+	 * Reads the resource from the current position of the given volume file.
+	 * If `mappedVolume` holds the contents of the volume file and the
+	 * resource is not compressed, the resource data refers to the volume
+	 * file contents instead of being copied.
+	 */
+	int decompress(ResVersion volVersion, Common::SeekableReadStream *file, const byte *mappedVolume = nullptr);
 	int readResourceInfo(ResVersion volVersion, Common::SeekableReadStream *file, uint32 &szPacked, ResourceCompression &compression);
+
+	/**
+	 * Checks the size of an audio resource stored in a regular resource
+	 * volume against its header, and trims the resource to the audio data.
+	 */
+	void validateAudioSize();
 };
 
 typedef Common::HashMap<ResourceId, Resource *, ResourceIdHash> ResourceMap;
@@ -538,6 +556,13 @@ protected:
 	 */
 	Common::SeekableReadStream *getVolumeFile(ResourceSource *source);
 	void disposeVolumeFileStream(Common::SeekableReadStream *fileStream, ResourceSource *source);
+
+	/**
+	 * Returns the entire contents of the given volume file stream if it was
+	 * returned by getVolumeFile and is memory mapped, or nullptr otherwise.
+	 * The contents remain valid until the ResourceManager is destroyed.
+	 */
+	const byte *getMappedVolumeData(const Common::SeekableReadStream *fileStream) const;
 	void loadResource(Resource *res);
 	void freeOldResources();
 	bool validateResource(const ResourceId &resourceId, const Common::String &sourceMapLocation, const Common::String &sourceName, const uint32 offset, const uint32 size, const uint32 sourceSize) const;
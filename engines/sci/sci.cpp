@@ -533,6 +533,7 @@ bool SciEngine::initGame() {
 
 	_gamestate->_msgState = new MessageState(_gamestate->_segMan);
 	_gamestate->gcCountDown = GC_INTERVAL - 1;
+	_gamestate->gcPendingFree.clear();
 
 	// Script 0 should always be at segment 1
 	if (script0Segment != 1) {
@@ -467,7 +467,7 @@ void RobotDecoder::initVideo(const int16 x, const int16 y, const int16 scale, co
 }
 
 void RobotDecoder::initRecordAndCuePositions() {
-	PositionList recordSizes;
+	PositionList &recordSizes = _recordSizes;
 	_videoSizes.reserve(_numFramesTotal);
 	_recordPositions.reserve(_numFramesTotal);
 	recordSizes.reserve(_numFramesTotal);
@@ -610,8 +610,9 @@ void RobotDecoder::close() {
 	_status = kRobotStatusUninitialized;
 	_videoSizes.clear();
 	_recordPositions.clear();
+	_recordSizes.clear();
+	clearRecordCache();
 	_celDecompressionBuffer.clear();
-	_doVersion5Scratch.clear();
 	delete _stream;
 	_stream = nullptr;
 }
@@ -670,7 +671,6 @@ void RobotDecoder::showFrame(const uint16 frameNo, const uint16 newX, const uint
 	pause();
 
 	if (frameNo != _previousFrameNo) {
-		seekToFrame(frameNo);
 		doVersion5(false);
 	} else {
 		for (RobotScreenItemList::size_type i = 0; i < _screenItemList.size(); ++i) {
@@ -1125,32 +1125,50 @@ bool RobotDecoder::readPrimerData(byte *outEvenBuffer, byte *outOddBuffer) {
 }
 
 bool RobotDecoder::readAudioDataFromRecord(const int frameNo, byte *outBuffer, int &outAudioPosition, int &outAudioSize) {
-	_stream->seek(_recordPositions[frameNo] + _videoSizes[frameNo], SEEK_SET);
+	// Audio for skipped frames and for priming is usually not in the record
+	// cache, and only the audio part of those records is needed, so it is
+	// read directly from the stream instead of going through getRecord
+	const CachedRecord *record = findCachedRecord(frameNo);
+	const byte *audioData = nullptr;
+	int position, size;
+	if (record != nullptr) {
+		const byte *audioHeader = record->data.begin() + _videoSizes[frameNo];
+
+		// Compressed absolute position of the audio block in the audio stream
+		position = (int32)READ_SCI11ENDIAN_UINT32(audioHeader);
+
+		// Size of the block of audio, excluding the audio block header
+		size = (int32)READ_SCI11ENDIAN_UINT32(audioHeader + 4);
+
+		audioData = audioHeader + kAudioBlockHeaderSize;
+	} else {
+		_stream->seek(_recordPositions[frameNo] + _videoSizes[frameNo], SEEK_SET);
+		position = _stream->readSint32();
+		size = _stream->readSint32();
+	}
 	_audioList.submitDriverMax();
 
-	// Compressed absolute position of the audio block in the audio stream
-	const int position = _stream->readSint32();
-
-	// Size of the block of audio, excluding the audio block header
-	int size = _stream->readSint32();
-
 	assert(size <= _expectedAudioBlockSize);
 
 	if (position == 0) {
 		return false;
 	}
 
+	byte *target = outBuffer;
 	if (size != _expectedAudioBlockSize) {
 		memset(outBuffer, 0, kRobotZeroCompressSize);
-		_stream->read(outBuffer + kRobotZeroCompressSize, size);
-		size += kRobotZeroCompressSize;
+		target += kRobotZeroCompressSize;
+	}
+
+	if (audioData != nullptr) {
+		memcpy(target, audioData, size);
 	} else {
-		_stream->read(outBuffer, size);
+		_stream->read(target, size);
 	}
 
 	outAudioPosition = position;
-	outAudioSize = size;
-	return !_stream->err();
+	outAudioSize = size + (target - outBuffer);
+	return audioData != nullptr || !_stream->err();
 }
 
 bool RobotDecoder::readPartialAudioRecordAndSubmit(const int startFrame, const int startPosition) {
@@ -1164,6 +1182,77 @@ bool RobotDecoder::readPartialAudioRecordAndSubmit(const int startFrame, const i
 	return success;
 }
 
+#pragma mark -
+#pragma mark RobotDecoder - Record cache
+
+const byte *RobotDecoder::getRecord(const int frameNo) {
+	const CachedRecord *record = findCachedRecord(frameNo);
+	if (record != nullptr) {
+		return record->data.begin();
+	}
+
+	// Records for frames that have already been played are discarded first,
+	// then the record furthest from the requested frame, so read-ahead
+	// records are not thrown away before they are used
+	CachedRecord *slot = &_recordCache[0];
+	for (int i = 0; i < kRecordCacheSize; ++i) {
+		CachedRecord &candidate = _recordCache[i];
+		if (candidate.frameNo == -1 || candidate.frameNo < _currentFrameNo) {
+			slot = &candidate;
+			break;
+		}
+
+		if (ABS(candidate.frameNo - frameNo) > ABS(slot->frameNo - frameNo)) {
+			slot = &candidate;
+		}
+	}
+
+	// The audio block header is always read along with the video data so
+	// readAudioDataFromRecord can trust any cached record to contain it
+	const int minimumSize = _videoSizes[frameNo] + (_hasAudio ? kAudioBlockHeaderSize : 0);
+
+	slot->frameNo = -1;
+	slot->data.resize(MAX(_recordSizes[frameNo], minimumSize));
+	seekToFrame(frameNo);
+	if (_stream->read(slot->data.begin(), slot->data.size()) != slot->data.size()) {
+		error("RobotDecoder::getRecord: Read error");
+	}
+	slot->frameNo = frameNo;
+
+	return slot->data.begin();
+}
+
+const RobotDecoder::CachedRecord *RobotDecoder::findCachedRecord(const int frameNo) const {
+	for (int i = 0; i < kRecordCacheSize; ++i) {
+		if (_recordCache[i].frameNo == frameNo) {
+			return &_recordCache[i];
+		}
+	}
+
+	return nullptr;
+}
+
+void RobotDecoder::readAheadRecords() {
+	if (_status != kRobotStatusPlaying) {
+		return;
+	}
+
+	const int lastFrameNo = MIN<int>(_currentFrameNo + kRecordReadAheadCount, _numFramesTotal - 1);
+	for (int frameNo = _currentFrameNo + 1; frameNo <= lastFrameNo; ++frameNo) {
+		getRecord(frameNo);
+		if (_hasAudio) {
+			_audioList.submitDriverMax();
+		}
+	}
+}
+
+void RobotDecoder::clearRecordCache() {
+	for (int i = 0; i < kRecordCacheSize; ++i) {
+		_recordCache[i].frameNo = -1;
+		_recordCache[i].data.clear();
+	}
+}
+
 #pragma mark -
 #pragma mark RobotDecoder - Rendering
 
@@ -1230,7 +1319,6 @@ void RobotDecoder::doRobot() {
 	}
 
 	_delayTime.startTiming();
-	seekToFrame(_currentFrameNo);
 	doVersion5();
 	if (_hasAudio) {
 		_audioList.submitDriverMax();
@@ -1274,6 +1362,8 @@ void RobotDecoder::frameNowVisible() {
 		_previousFrameNo = _currentFrameNo;
 	}
 
+	readAheadRecords();
+
 	if (!_syncFrame && _hasAudio && getTickCount() >= _checkAudioSyncTime) {
 		RobotAudioStream::StreamState status;
 		const bool success = g_sci->_audio32->queryRobotAudio(status);
@@ -1351,14 +1441,7 @@ void RobotDecoder::setPriority(const int16 newPriority) {
 
 void RobotDecoder::doVersion5(const bool shouldSubmitAudio) {
 	const RobotScreenItemList::size_type oldScreenItemCount = _screenItemList.size();
-	const int videoSize = _videoSizes[_currentFrameNo];
-	_doVersion5Scratch.resize(videoSize);
-
-	byte *videoFrameData = _doVersion5Scratch.begin();
-
-	if (!_stream->read(videoFrameData, videoSize)) {
-		error("RobotDecoder::doVersion5: Read error");
-	}
+	const byte *videoFrameData = getRecord(_currentFrameNo);
 
 	const RobotScreenItemList::size_type screenItemCount = READ_SCI11ENDIAN_UINT16(videoFrameData);
 
@@ -546,6 +546,17 @@ private:
 		 */
 		kCelHeaderSize         = 22,
 
+		/**
+		 * Maximum number of raw records held in the record cache.
+		 */
+		kRecordCacheSize       = 4,
+
+		/**
+		 * The number of records following the current frame that are read
+		 * into the record cache once the current frame is on screen.
+		 */
+		kRecordReadAheadCount  = 3,
+
 		/**
 		 * The maximum amount that the frame rate is allowed to drift from the
 		 * nominal frame rate in order to correct for AV drift or slow playback.
@@ -1101,6 +1112,64 @@ private:
 	 */
 	bool readPartialAudioRecordAndSubmit(const int startFrame, const int startPosition);
 
+#pragma mark -
+#pragma mark Record cache
+private:
+	/**
+	 * A raw video and audio record read from the robot stream.
+	 */
+	struct CachedRecord {
+		/**
+		 * The frame number of the record, or -1 if the slot is unused.
+		 */
+		int frameNo;
+
+		/**
+		 * The raw record data.
+		 */
+		Common::Array<byte> data;
+
+		CachedRecord() : frameNo(-1) {}
+	};
+
+	/**
+	 * Raw records which have been read from the robot stream. Each record is
+	 * read in a single operation, and records for upcoming frames are read
+	 * after the current frame has been shown instead of when they are needed
+	 * by doRobot, so a slow read does not delay the frame being drawn.
+	 */
+	CachedRecord _recordCache[kRecordCacheSize];
+
+	/**
+	 * A list of the sizes, in bytes, of the record for each frame of the
+	 * robot.
+	 */
+	PositionList _recordSizes;
+
+	/**
+	 * Returns the raw record for the given frame number, reading it from the
+	 * robot stream if it is not already in the record cache. The returned
+	 * data is valid until the next call to getRecord or readAheadRecords.
+	 */
+	const byte *getRecord(const int frameNo);
+
+	/**
+	 * Returns the cached record for the given frame number, or nullptr if it
+	 * is not in the record cache.
+	 */
+	const CachedRecord *findCachedRecord(const int frameNo) const;
+
+	/**
+	 * Reads the records of the frames following the current frame into the
+	 * record cache.
+	 */
+	void readAheadRecords();
+
+	/**
+	 * Removes all records from the record cache.
+	 */
+	void clearRecordCache();
+
 #pragma mark -
 #pragma mark Rendering
 public:
@@ -1314,12 +1383,6 @@ private:
 	 */
 	bool _syncFrame;
 
-	/**
-	 * Scratch memory used to store the compressed robot video data for the
-	 * current frame.
-	 */
-	ScratchMemory _doVersion5Scratch;
-
 	/**
 	 * When set to a non-negative value, forces the next call to doRobot to
 	 * render the given frame number instead of whatever frame would have
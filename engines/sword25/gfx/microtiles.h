@@ -23,40 +23,20 @@
 #ifndef SWORD25_MICROTILES_H
 #define SWORD25_MICROTILES_H
 
-#include "common/scummsys.h"
 #include "common/list.h"
-#include "common/util.h"
 #include "common/rect.h"
 
-namespace Sword25 {
-
-typedef uint32 BoundingBox;
+#include "graphics/microtiles.h"
 
-const BoundingBox FullBoundingBox  = 0x00001F1F;
-const BoundingBox EmptyBoundingBox = 0x00000000;
-const int TileSize = 32;
+namespace Sword25 {
 
 class RectangleList : public Common::List<Common::Rect> {
 };
 
-class MicroTileArray {
+class MicroTileArray : public Graphics::MicroTileArray {
 public:
-	MicroTileArray(int16 width, int16 height);
-	~MicroTileArray();
-	void addRect(Common::Rect r);
-	void clear();
+	MicroTileArray(int16 width, int16 height) : Graphics::MicroTileArray(width, height) {}
 	RectangleList *getRectangles();
-protected:
-	BoundingBox *_tiles;
-	int16 _tilesW, _tilesH;
-	byte TileX0(const BoundingBox &boundingBox);
-	byte TileY0(const BoundingBox &boundingBox);
-	byte TileX1(const BoundingBox &boundingBox);
-	byte TileY1(const BoundingBox &boundingBox);
-	bool isBoundingBoxEmpty(const BoundingBox &boundingBox);
-	bool isBoundingBoxFull(const BoundingBox &boundingBox);
-	void setBoundingBox(BoundingBox &boundingBox, byte x0, byte y0, byte x1, byte y1);
-	void updateBoundingBox(BoundingBox &boundingBox, byte x0, byte y0, byte x1, byte y1);
 };
 
 } // namespace Sword25
@@ -118,6 +118,23 @@ void InputPersistenceBlock::readByteArray(Common::Array<byte> &value) {
 	}
 }
 
+const byte *InputPersistenceBlock::readByteArrayData(uint32 &size) {
+	size = 0;
+
+	if (checkMarker(BLOCK_MARKER)) {
+		read(size);
+
+		if (checkBlockSize(size)) {
+			const byte *data = &*_iter;
+			_iter += size;
+			return data;
+		}
+	}
+
+	size = 0;
+	return NULL;
+}
+
 bool InputPersistenceBlock::checkBlockSize(int size) {
 	if (_data.end() - _iter >= size) {
 		return true;
@@ -57,6 +57,13 @@ public:
 	void readString(Common::String &value);
 	void readByteArray(Common::Array<byte> &value);
 
+	/**
+	 * Reads a block of data like readByteArray(), but without copying it.
+	 * @return              A pointer to the data, which is owned by the persistence
+	 *                      block, or NULL if no block could be read.
+	 */
+	const byte *readByteArrayData(uint32 &size);
+
 	bool isGood() const {
 		return _errorState == NONE;
 	}
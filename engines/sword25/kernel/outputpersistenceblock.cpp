@@ -37,6 +37,27 @@ const uint INITIAL_BUFFER_SIZE = 1024 * 64;
 
 namespace Sword25 {
 
+OutputPersistenceBlock::BlockWriteStream::BlockWriteStream(OutputPersistenceBlock &block) : _block(block) {
+	_block.writeMarker(BLOCK_MARKER);
+
+	// The size is filled in once all the data has been written
+	_block.write((uint32)0);
+	_start = _block._data.size();
+}
+
+OutputPersistenceBlock::BlockWriteStream::~BlockWriteStream() {
+	WRITE_LE_UINT32(&_block._data[_start - sizeof(uint32)], _block._data.size() - _start);
+}
+
+uint32 OutputPersistenceBlock::BlockWriteStream::write(const void *dataPtr, uint32 dataSize) {
+	_block.rawWrite(dataPtr, dataSize);
+	return dataSize;
+}
+
+int32 OutputPersistenceBlock::BlockWriteStream::pos() const {
+	return _block._data.size() - _start;
+}
+
 OutputPersistenceBlock::OutputPersistenceBlock() {
 	_data.reserve(INITIAL_BUFFER_SIZE);
 }
@@ -99,6 +120,14 @@ void OutputPersistenceBlock::writeMarker(byte marker) {
 void OutputPersistenceBlock::rawWrite(const void *dataPtr, size_t size) {
 	if (size > 0) {
 		uint oldSize = _data.size();
+
+		// resize() allocates exactly the requested size, so reserve powers of
+		// two to avoid copying the whole buffer on every write
+		uint newCapacity = INITIAL_BUFFER_SIZE;
+		while (newCapacity < oldSize + size)
+			newCapacity *= 2;
+		_data.reserve(newCapacity);
+
 		_data.resize(oldSize + size);
 		memcpy(&_data[oldSize], dataPtr, size);
 	}
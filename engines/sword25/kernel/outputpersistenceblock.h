@@ -32,6 +32,7 @@
 #ifndef SWORD25_OUTPUTPERSISTENCEBLOCK_H
 #define SWORD25_OUTPUTPERSISTENCEBLOCK_H
 
+#include "common/stream.h"
 #include "sword25/kernel/common.h"
 #include "sword25/kernel/persistenceblock.h"
 
@@ -39,6 +40,24 @@ namespace Sword25 {
 
 class OutputPersistenceBlock : public PersistenceBlock {
 public:
+	/**
+	 * Writes a block of data whose size is not known in advance directly into
+	 * the persistence block. The block can be read back with readByteArray()
+	 * once the stream has been destroyed.
+	 */
+	class BlockWriteStream : public Common::WriteStream {
+	public:
+		BlockWriteStream(OutputPersistenceBlock &block);
+		~BlockWriteStream();
+
+		virtual uint32 write(const void *dataPtr, uint32 dataSize);
+		virtual int32 pos() const;
+
+	private:
+		OutputPersistenceBlock &_block;
+		uint _start;
+	};
+
 	OutputPersistenceBlock();
 
 	void write(const void *data, uint32 size);
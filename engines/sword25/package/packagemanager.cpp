@@ -57,6 +57,7 @@ static Common::String normalizePath(const Common::String &path, const Common::St
 PackageManager::PackageManager(Kernel *pKernel) : Service(pKernel),
 	_currentDirectory(PATH_SEPARATOR),
 	_rootFolder(ConfMan.get("path")),
+	_unindexedArchiveCount(0),
 	_useEnglishSpeech(ConfMan.getBool("english_speech")) {
 	if (!registerScriptBindings())
 		error("Script bindings could not be registered.");
@@ -96,6 +97,15 @@ Common::String PackageManager::ensureSpeechLang(const Common::String &fileName)
  */
 Common::ArchiveMemberPtr PackageManager::getArchiveMember(const Common::String &fileName) {
 	Common::String fileName2 = ensureSpeechLang(fileName);
+
+	if (!_unindexedArchiveCount) {
+		FileIndex::const_iterator member = _fileIndex.find(fileName2);
+		if (member == _fileIndex.end())
+			return Common::ArchiveMemberPtr();
+
+		return member->_value;
+	}
+
 	// Loop through checking each archive
 	Common::List<ArchiveEntry *>::iterator i;
 	for (i = _archiveList.begin(); i != _archiveList.end(); ++i) {
@@ -131,8 +141,10 @@ bool PackageManager::loadPackage(const Common::String &fileName, const Common::S
 		zipFile->listMembers(files);
 		debug(3, "Capacity %d", files.size());
 
-		for (Common::ArchiveMemberList::iterator it = files.begin(); it != files.end(); ++it)
+		for (Common::ArchiveMemberList::iterator it = files.begin(); it != files.end(); ++it) {
 			debug(3, "%s", (*it)->getName().c_str());
+			_fileIndex[mountPosition + (*it)->getName()] = *it;
+		}
 
 		_archiveList.push_front(new ArchiveEntry(zipFile, mountPosition));
 
@@ -153,6 +165,7 @@ bool PackageManager::loadDirectoryAsPackage(const Common::String &directoryName,
 		folderArchive->listMembers(files);
 		debug(0, "Capacity %d", files.size());
 
+		++_unindexedArchiveCount;
 		_archiveList.push_front(new ArchiveEntry(folderArchive, mountPosition));
 
 		return true;
@@ -252,6 +265,23 @@ int PackageManager::doSearch(Common::ArchiveMemberList &list, const Common::Stri
 	if (path.size() > 0)
 		warning("STUB: PackageManager::doSearch(<%s>, <%s>, %d)", filter.c_str(), path.c_str(), typeFilter);
 
+	if (!_unindexedArchiveCount) {
+		// The index holds every path once, so there are no duplicates to remove
+		for (FileIndex::const_iterator it = _fileIndex.begin(); it != _fileIndex.end(); ++it) {
+			if (!it->_key.matchString(normalizedFilter, true, true))
+				continue;
+
+			const bool isDirectory = it->_key.hasSuffix("/");
+			if (((typeFilter & PackageManager::FT_DIRECTORY) && isDirectory) ||
+				((typeFilter & PackageManager::FT_FILE) && !isDirectory)) {
+				list.push_back(it->_value);
+				num++;
+			}
+		}
+
+		return num;
+	}
+
 	// Loop through checking each archive
 	Common::List<ArchiveEntry *>::iterator i;
 	for (i = _archiveList.begin(); i != _archiveList.end(); ++i) {
@@ -50,6 +50,7 @@
 #include "common/archive.h"
 #include "common/array.h"
 #include "common/fs.h"
+#include "common/hashmap.h"
 #include "common/str.h"
 
 #include "sword25/kernel/common.h"
@@ -84,10 +85,26 @@ private:
 		}
 	};
 
+	typedef Common::HashMap<Common::String, Common::ArchiveMemberPtr, Common::IgnoreCase_Hash, Common::IgnoreCase_EqualTo> FileIndex;
+
 	Common::String _currentDirectory;
 	Common::FSNode _rootFolder;
 	Common::List<ArchiveEntry *> _archiveList;
 
+	/**
+	 * The members of all mounted packages, indexed by their absolute path.
+	 * Members of packages mounted later replace the ones of earlier packages,
+	 * just like when searching _archiveList from the front.
+	 */
+	FileIndex _fileIndex;
+
+	/**
+	 * The number of mounted directories. Their members have no full path, so
+	 * they can't be indexed, and paths have to be looked up in every archive
+	 * as long as any directory is mounted.
+	 */
+	uint _unindexedArchiveCount;
+
 	bool _useEnglishSpeech;
 	Common::String ensureSpeechLang(const Common::String &fileName);
 
@@ -29,6 +29,7 @@
  *
  */
 
+#include "common/config-manager.h"
 #include "common/memstream.h"
 #include "common/debug-channels.h"
 
@@ -84,6 +85,8 @@ bool LuaScriptEngine::init() {
 	// Register panic callback function
 	lua_atpanic(_state, panicCB);
 
+	configureGarbageCollector();
+
 	// Error handler for lua_pcall calls
 	// The code below contains a local error handler function
 	const char errorHandlerCode[] =
@@ -141,6 +144,19 @@ bool LuaScriptEngine::executeFile(const Common::String &fileName) {
 	PackageManager *pPackage = Kernel::getInstance()->getPackage();
 	assert(pPackage);
 
+	const Common::String chunkName = "@" + pPackage->getAbsolutePath(fileName);
+
+	// Reuse the chunk if the file has been compiled before
+	CompiledChunkMap::const_iterator chunk = _compiledChunks.find(chunkName);
+	if (chunk != _compiledChunks.end()) {
+		lua_rawgeti(_state, LUA_REGISTRYINDEX, chunk->_value);
+		bool result = executeChunk(chunkName);
+#ifdef DEBUG
+		assert(__startStackDepth == lua_gettop(_state));
+#endif
+		return result;
+	}
+
 	// File read
 	uint fileSize;
 	byte *fileData = pPackage->getFile(fileName, &fileSize);
@@ -152,9 +168,10 @@ bool LuaScriptEngine::executeFile(const Common::String &fileName) {
 		return false;
 	}
 
-	// Run the file content
-	if (!executeBuffer(fileData, fileSize, "@" + pPackage->getAbsolutePath(fileName))) {
-		// Release file buffer
+	// Compile the file content
+	if (luaL_loadbuffer(_state, (const char *)fileData, fileSize, chunkName.c_str()) != 0) {
+		error("Couldn't compile \"%s\":\n%s", chunkName.c_str(), lua_tostring(_state, -1));
+		lua_pop(_state, 1);
 		delete[] fileData;
 #ifdef DEBUG
 		assert(__startStackDepth == lua_gettop(_state));
@@ -165,11 +182,18 @@ bool LuaScriptEngine::executeFile(const Common::String &fileName) {
 	// Release file buffer
 	delete[] fileData;
 
+	// Keep a reference to the compiled chunk in the registry for later calls
+	lua_pushvalue(_state, -1);
+	_compiledChunks[chunkName] = luaL_ref(_state, LUA_REGISTRYINDEX);
+
+	// Run the file content
+	bool result = executeChunk(chunkName);
+
 #ifdef DEBUG
 	assert(__startStackDepth == lua_gettop(_state));
 #endif
 
-	return true;
+	return result;
 }
 
 bool LuaScriptEngine::executeString(const Common::String &code) {
@@ -199,6 +223,16 @@ bool LuaScriptEngine::registerStandardLibs() {
 	return true;
 }
 
+void LuaScriptEngine::configureGarbageCollector() {
+	// Lua collects garbage incrementally. The pause controls how much the heap
+	// may grow before a new cycle starts, and the step multiplier how much work
+	// is done in each step relative to the allocation speed.
+	if (ConfMan.hasKey("lua_gc_pause"))
+		lua_gc(_state, LUA_GCSETPAUSE, ConfMan.getInt("lua_gc_pause"));
+	if (ConfMan.hasKey("lua_gc_stepmul"))
+		lua_gc(_state, LUA_GCSETSTEPMUL, ConfMan.getInt("lua_gc_stepmul"));
+}
+
 bool LuaScriptEngine::executeBuffer(const byte *data, uint size, const Common::String &name) const {
 	// Compile buffer
 	if (luaL_loadbuffer(_state, (const char *)data, size, name.c_str()) != 0) {
@@ -208,6 +242,10 @@ bool LuaScriptEngine::executeBuffer(const byte *data, uint size, const Common::S
 		return false;
 	}
 
+	return executeChunk(name);
+}
+
+bool LuaScriptEngine::executeChunk(const Common::String &name) const {
 	// Error handling function to be executed after the function is put on the stack
 	lua_rawgeti(_state, LUA_REGISTRYINDEX, _pcallErrorhandlerRegistryIndex);
 	lua_insert(_state, -2);
@@ -394,12 +432,11 @@ bool LuaScriptEngine::persist(OutputPersistenceBlock &writer) {
 	pushPermanentsTable(_state, PTT_PERSIST);
 	lua_getglobal(_state, "_G");
 
-	// Lua persists and stores the data in a WriteStream
-	Common::MemoryWriteStreamDynamic writeStream(DisposeAfterUse::YES);
-	Lua::persistLua(_state, &writeStream);
-
-	// Persistenzdaten in den Writer schreiben.
-	writer.write(writeStream.getData(), writeStream.size());
+	// Lua persists the data straight into the writer
+	{
+		OutputPersistenceBlock::BlockWriteStream writeStream(writer);
+		Lua::persistLua(_state, &writeStream);
+	}
 
 	// Die beiden Tabellen vom Stack nehmen.
 	lua_pop(_state, 2);
@@ -478,9 +515,9 @@ bool LuaScriptEngine::unpersist(InputPersistenceBlock &reader) {
 	clearGlobalTable(_state, clearExceptionsSecondPass);
 
 	// Persisted Lua data
-	Common::Array<byte> chunkData;
-	reader.readByteArray(chunkData);
-	Common::MemoryReadStream readStream(&chunkData[0], chunkData.size(), DisposeAfterUse::NO);
+	uint32 chunkSize;
+	const byte *chunkData = reader.readByteArrayData(chunkSize);
+	Common::MemoryReadStream readStream(chunkData, chunkSize, DisposeAfterUse::NO);
 
 	Lua::unpersistLua(_state, &readStream);
 
@@ -32,6 +32,7 @@
 #ifndef SWORD25_LUASCRIPT_H
 #define SWORD25_LUASCRIPT_H
 
+#include "common/hashmap.h"
 #include "common/str.h"
 #include "common/str-array.h"
 #include "sword25/kernel/common.h"
@@ -94,12 +95,28 @@ public:
 	virtual bool unpersist(InputPersistenceBlock &reader);
 
 private:
+	typedef Common::HashMap<Common::String, int> CompiledChunkMap;
+
 	lua_State *_state;
 	int _pcallErrorhandlerRegistryIndex;
 
+	/**
+	 * Registry indexes of the compiled chunks of all script files executed so
+	 * far, keyed by their absolute path. Package files don't change while the
+	 * game is running, so executing a file again reuses its compiled chunk
+	 * instead of reading and parsing the file again.
+	 */
+	CompiledChunkMap _compiledChunks;
+
 	bool registerStandardLibs();
 	bool registerStandardLibExtensions();
+	void configureGarbageCollector();
 	bool executeBuffer(const byte *data, uint size, const Common::String &name) const;
+
+	/**
+	 * Runs the compiled chunk on top of the Lua stack and pops it
+	 */
+	bool executeChunk(const Common::String &name) const;
 };
 
 } // End of namespace Sword25
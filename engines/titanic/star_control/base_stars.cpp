@@ -59,12 +59,13 @@ bool CBaseStarEntry::operator==(const CBaseStarEntry &s) const {
 
 /*------------------------------------------------------------------------*/
 
-CBaseStars::CBaseStars() : _minVal(0.0), _maxVal(1.0), _range(0.0),
+CBaseStars::CBaseStars() : _projectedCount(0), _minVal(0.0), _maxVal(1.0), _range(0.0),
 		_value1(0.0), _value2(0.0), _value3(0.0), _value4(0.0) {
 }
 
 void CBaseStars::clear() {
 	_data.clear();
+	updatePositions();
 }
 
 void CBaseStars::initialize() {
@@ -102,6 +103,8 @@ void CBaseStars::loadData(Common::SeekableReadStream &s) {
 	// Iterate through reading the data for each entry
 	for (uint idx = 0; idx < count; ++idx)
 		_data[idx].load(s);
+
+	updatePositions();
 }
 
 void CBaseStars::loadData(const CString &resName) {
@@ -126,6 +129,71 @@ void CBaseStars::resetEntry(CBaseStarEntry &entry) {
 		entry._data[idx] = 0;
 }
 
+void CBaseStars::updatePositions() {
+	const uint count = _data.size();
+	_positionsX.resize(count);
+	_positionsY.resize(count);
+	_positionsZ.resize(count);
+	_depths.resize(count);
+	_projectedIndexes.resize(count);
+	_projectedX.resize(count);
+	_projectedY.resize(count);
+	_projectedZ.resize(count);
+	_projectedDist2.resize(count);
+	_projectedCount = 0;
+
+	for (uint idx = 0; idx < count; ++idx) {
+		const FVector &position = _data[idx]._position;
+		_positionsX[idx] = position._x;
+		_positionsY[idx] = position._y;
+		_positionsZ[idx] = position._z;
+	}
+}
+
+void CBaseStars::projectStars(const FPose &pose, double minZ) {
+	const uint count = _data.size();
+	_projectedCount = 0;
+	if (!count)
+		return;
+
+	const float *posX = &_positionsX[0];
+	const float *posY = &_positionsY[0];
+	const float *posZ = &_positionsZ[0];
+	float *depths = &_depths[0];
+
+	// Most stars are behind the camera, so only the depth is calculated for
+	// all of them, in a tight loop without any branches
+	for (uint idx = 0; idx < count; ++idx) {
+		depths[idx] = posX[idx] * pose._row1._z + posY[idx] * pose._row2._z
+			+ posZ[idx] * pose._row3._z + pose._vector._z;
+	}
+
+	uint *indexes = &_projectedIndexes[0];
+	uint visible = 0;
+	for (uint idx = 0; idx < count; ++idx) {
+		indexes[visible] = idx;
+		visible += (depths[idx] > minZ) ? 1 : 0;
+	}
+
+	float *projX = &_projectedX[0];
+	float *projY = &_projectedY[0];
+	float *projZ = &_projectedZ[0];
+	double *dist2 = &_projectedDist2[0];
+	for (uint i = 0; i < visible; ++i) {
+		const uint idx = indexes[i];
+		const float tempX = posX[idx] * pose._row1._x + posY[idx] * pose._row2._x + posZ[idx] * pose._row3._x + pose._vector._x;
+		const float tempY = posX[idx] * pose._row1._y + posY[idx] * pose._row2._y + posZ[idx] * pose._row3._y + pose._vector._y;
+		const float tempZ = depths[idx];
+
+		projX[i] = tempX;
+		projY[i] = tempY;
+		projZ[i] = tempZ;
+		dist2[i] = (double)tempY * tempY + (double)tempX * tempX + (double)tempZ * tempZ;
+	}
+
+	_projectedCount = visible;
+}
+
 void CBaseStars::draw(CSurfaceArea *surfaceArea, CStarCamera *camera, CStarCloseup *closeup) {
 	if (!_data.empty()) {
 		switch (camera->getStarColor()) {
@@ -174,17 +242,15 @@ void CBaseStars::draw1(CSurfaceArea *surfaceArea, CStarCamera *camera, CStarClos
 	double *v1Ptr = &_value1, *v2Ptr = &_value2;
 	double tempX, tempY, tempZ, total2;
 
-	for (uint idx = 0; idx < _data.size(); ++idx) {
-		CBaseStarEntry &entry = _data[idx];
-		const FVector &vector = entry._position;
-		tempZ = vector._x * pose._row1._z + vector._y * pose._row2._z
-			+ vector._z * pose._row3._z + pose._vector._z;
-		if (tempZ <= minVal)
-			continue;
+	projectStars(pose, minVal);
 
-		tempY = vector._x * pose._row1._y + vector._y * pose._row2._y + vector._z * pose._row3._y + pose._vector._y;
-		tempX = vector._x * pose._row1._x + vector._y * pose._row2._x + vector._z * pose._row3._x + pose._vector._x;
-		total2 = tempY * tempY + tempX * tempX + tempZ * tempZ; 
+	for (uint star = 0; star < _projectedCount; ++star) {
+		const CBaseStarEntry &entry = _data[_projectedIndexes[star]];
+		const FVector &vector = entry._position;
+		tempX = _projectedX[star];
+		tempY = _projectedY[star];
+		tempZ = _projectedZ[star];
+		total2 = _projectedDist2[star];
 
 		if (total2 < 1.0e12) {
 			closeup->draw(pose, vector, FVector(centroid._x, centroid._y, total2),
@@ -259,17 +325,15 @@ void CBaseStars::draw2(CSurfaceArea *surfaceArea, CStarCamera *camera, CStarClos
 	double *v1Ptr = &_value1, *v2Ptr = &_value2;
 	double tempX, tempY, tempZ, total2;
 
-	for (uint idx = 0; idx < _data.size(); ++idx) {
-		CBaseStarEntry &entry = _data[idx];
-		const FVector &vector = entry._position;
-		tempZ = vector._x * pose._row1._z + vector._y * pose._row2._z
-			+ vector._z * pose._row3._z + pose._vector._z;
-		if (tempZ <= minVal)
-			continue;
+	projectStars(pose, minVal);
 
-		tempY = vector._x * pose._row1._y + vector._y * pose._row2._y + vector._z * pose._row3._y + pose._vector._y;
-		tempX = vector._x * pose._row1._x + vector._y * pose._row2._x + vector._z * pose._row3._x + pose._vector._x;
-		total2 = tempY * tempY + tempX * tempX + tempZ * tempZ;
+	for (uint star = 0; star < _projectedCount; ++star) {
+		const CBaseStarEntry &entry = _data[_projectedIndexes[star]];
+		const FVector &vector = entry._position;
+		tempX = _projectedX[star];
+		tempY = _projectedY[star];
+		tempZ = _projectedZ[star];
+		total2 = _projectedDist2[star];
 
 		if (total2 < 1.0e12) {
 			closeup->draw(pose, vector, FVector(centroid._x, centroid._y, total2),
@@ -348,17 +412,15 @@ void CBaseStars::draw3(CSurfaceArea *surfaceArea, CStarCamera *camera, CStarClos
 	int xStart, yStart, rgb;
 	uint16 *pixelP;
 
-	for (uint idx = 0; idx < _data.size(); ++idx) {
-		CBaseStarEntry &entry = _data[idx];
-		const FVector &vector = entry._position;
-		tempZ = vector._x * pose._row1._z + vector._y * pose._row2._z
-			+ vector._z * pose._row3._z + pose._vector._z;
-		if (tempZ <= minVal)
-			continue;
+	projectStars(pose, minVal);
 
-		tempY = vector._x * pose._row1._y + vector._y * pose._row2._y + vector._z * pose._row3._y + pose._vector._y;
-		tempX = vector._x * pose._row1._x + vector._y * pose._row2._x + vector._z * pose._row3._x + pose._vector._x;
-		total2 = tempY * tempY + tempX * tempX + tempZ * tempZ;
+	for (uint star = 0; star < _projectedCount; ++star) {
+		const CBaseStarEntry &entry = _data[_projectedIndexes[star]];
+		const FVector &vector = entry._position;
+		tempX = _projectedX[star];
+		tempY = _projectedY[star];
+		tempZ = _projectedZ[star];
+		total2 = _projectedDist2[star];
 
 		if (total2 < 1.0e12) {
 			closeup->draw(pose, vector, FVector(centroid._x, centroid._y, total2),
@@ -409,13 +471,6 @@ void CBaseStars::draw3(CSurfaceArea *surfaceArea, CStarCamera *camera, CStarClos
 		if (xStart < 0 || xStart >= width1 || yStart < 0 || yStart >= height1)
 			continue;
 
-		sVal = sqrt(total2);
-		sVal = (sVal < 100000.0) ? 1.0 : 1.0 - ((sVal - 100000.0) / 1.0e9);
-		sVal *= 255.0;
-
-		if (sVal > 255.0)
-			sVal = 255.0;
-
 		if (sVal > 2.0) {
 			pixelP = (uint16 *)(surfaceArea->_pixelsPtr + surfaceArea->_pitch * yStart + xStart * 2);
 			rgb = ((int)(sVal - 0.5) & 0xf8) << 7;
@@ -454,18 +509,15 @@ void CBaseStars::draw4(CSurfaceArea *surfaceArea, CStarCamera *camera, CStarClos
 	int xStart, yStart, rgb;
 	uint16 *pixelP;
 
-	for (uint idx = 0; idx < _data.size(); ++idx) {
-		const CBaseStarEntry &entry = _data[idx];
-		const FVector &vector = entry._position;
+	projectStars(pose, minVal);
 
-		tempZ = vector._x * pose._row1._z + vector._y * pose._row2._z
-			+ vector._z * pose._row3._z + pose._vector._z;
-		if (tempZ <= minVal)
-			continue;
-	
-		tempY = vector._x * pose._row1._y + vector._y * pose._row2._y + vector._z * pose._row3._y + pose._vector._y;
-		tempX = vector._x * pose._row1._x + vector._y * pose._row2._x + vector._z * pose._row3._x + pose._vector._x;
-		total2 = tempY * tempY + tempX * tempX + tempZ * tempZ;
+	for (uint star = 0; star < _projectedCount; ++star) {
+		const CBaseStarEntry &entry = _data[_projectedIndexes[star]];
+		const FVector &vector = entry._position;
+		tempX = _projectedX[star];
+		tempY = _projectedY[star];
+		tempZ = _projectedZ[star];
+		total2 = _projectedDist2[star];
 
 		if (total2 < 1.0e12) {
 			// We're in close proximity to the given star, so draw a closeup of it
@@ -517,13 +569,6 @@ void CBaseStars::draw4(CSurfaceArea *surfaceArea, CStarCamera *camera, CStarClos
 		if (xStart < 0 || xStart >= width1 || yStart < 0 || yStart >= height1)
 			continue;
 
-		sVal = sqrt(total2);
-		sVal = (sVal < 100000.0) ? 1.0 : 1.0 - ((sVal - 100000.0) / 1.0e9);
-		sVal *= 255.0;
-
-		if (sVal > 255.0)
-			sVal = 255.0;
-
 		if (sVal > 2.0) {
 			pixelP = (uint16 *)(surfaceArea->_pixelsPtr + surfaceArea->_pitch * yStart + xStart * 2);
 			rgb = ((int)(sVal - 0.5) >> 3) & 0xff;
@@ -36,6 +36,7 @@ enum StarMode { MODE_STARFIELD = 0, MODE_PHOTO = 1 };
 
 class CStarCamera;
 class CStarCloseup;
+class FPose;
 class CString;
 class CSurfaceArea;
 class SimpleFile;
@@ -78,6 +79,32 @@ private:
 	void draw2(CSurfaceArea *surfaceArea, CStarCamera *camera, CStarCloseup *closeup);
 	void draw3(CSurfaceArea *surfaceArea, CStarCamera *camera, CStarCloseup *closeup);
 	void draw4(CSurfaceArea *surfaceArea, CStarCamera *camera, CStarCloseup *closeup);
+
+	/**
+	 * Transforms all the stars into camera space in one batch, and gathers
+	 * the ones in front of the given depth into the projected arrays
+	 */
+	void projectStars(const FPose &pose, double minZ);
+private:
+	/**
+	 * Star positions, one array per coordinate, so that transforming all
+	 * the stars runs over contiguous memory
+	 */
+	Common::Array<float> _positionsX, _positionsY, _positionsZ;
+
+	/**
+	 * Camera space depth of every star for the current frame
+	 */
+	Common::Array<float> _depths;
+
+	/**
+	 * Indexes and camera space coordinates of the stars that passed the
+	 * depth test for the current frame
+	 */
+	Common::Array<uint> _projectedIndexes;
+	Common::Array<float> _projectedX, _projectedY, _projectedZ;
+	Common::Array<double> _projectedDist2;
+	uint _projectedCount;
 protected:
 	FRange _minMax;
 	double _minVal;
@@ -100,6 +127,12 @@ protected:
 	 * Reset the data for an entry
 	 */
 	void resetEntry(CBaseStarEntry &entry);
+
+	/**
+	 * Copies the star positions into the separate coordinate arrays. This
+	 * must be called whenever the star data changes.
+	 */
+	void updatePositions();
 public:
 	Common::Array<CBaseStarEntry> _data;
 public:
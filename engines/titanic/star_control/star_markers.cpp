@@ -77,6 +77,7 @@ bool CStarMarkers::addStar(const CBaseStarEntry *entry) {
 		if (star == *entry) {
 			// Found a matching star at the exact same position, so remove it instead
 			_data.remove_at(idx);
+			updatePositions();
 			return true;
 		}
 	}
@@ -88,6 +89,7 @@ bool CStarMarkers::addStar(const CBaseStarEntry *entry) {
 
 	// Add new star
 	_data.push_back(*entry);
+	updatePositions();
 	return true;
 }
 
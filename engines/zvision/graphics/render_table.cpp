@@ -30,10 +30,13 @@ namespace ZVision {
 RenderTable::RenderTable(uint numColumns, uint numRows)
 	: _numRows(numRows),
 	  _numColumns(numColumns),
+	  _bilinearWeights(nullptr),
 	  _renderState(FLAT) {
 	assert(numRows != 0 && numColumns != 0);
 
-	_internalBuffer = new Common::Point[numRows * numColumns];
+	_internalBuffer = new uint32[numRows * numColumns];
+	for (uint32 i = 0; i < numRows * numColumns; ++i)
+		_internalBuffer[i] = i;
 
 	memset(&_panoramaOptions, 0, sizeof(_panoramaOptions));
 	memset(&_tiltOptions, 0, sizeof(_tiltOptions));
@@ -41,6 +44,7 @@ RenderTable::RenderTable(uint numColumns, uint numRows)
 
 RenderTable::~RenderTable() {
 	delete[] _internalBuffer;
+	delete[] _bilinearWeights;
 }
 
 void RenderTable::setRenderState(RenderState newState) {
@@ -64,6 +68,20 @@ void RenderTable::setRenderState(RenderState newState) {
 	}
 }
 
+void RenderTable::setBilinearFiltering(bool enable) {
+	if (enable == (_bilinearWeights != nullptr))
+		return;
+
+	if (enable) {
+		_bilinearWeights = new uint16[_numRows * _numColumns];
+		memset(_bilinearWeights, 0, _numRows * _numColumns * sizeof(uint16));
+		generateRenderTable();
+	} else {
+		delete[] _bilinearWeights;
+		_bilinearWeights = nullptr;
+	}
+}
+
 const Common::Point RenderTable::convertWarpedCoordToFlatCoord(const Common::Point &point) {
 	// If we're outside the range of the RenderTable, no warping is happening. Return the maximum image coords
 	if (point.x >= (int16)_numColumns || point.y >= (int16)_numRows || point.x < 0 || point.y < 0) {
@@ -74,52 +92,81 @@ const Common::Point RenderTable::convertWarpedCoordToFlatCoord(const Common::Poi
 
 	uint32 index = point.y * _numColumns + point.x;
 
-	Common::Point newPoint(point);
-	newPoint.x += _internalBuffer[index].x;
-	newPoint.y += _internalBuffer[index].y;
-
-	return newPoint;
+	return Common::Point(_internalBuffer[index] % _numColumns, _internalBuffer[index] / _numColumns);
 }
 
 void RenderTable::mutateImage(uint16 *sourceBuffer, uint16 *destBuffer, uint32 destWidth, const Common::Rect &subRect) {
-	uint32 destOffset = 0;
-
 	for (int16 y = subRect.top; y < subRect.bottom; ++y) {
-		uint32 sourceOffset = y * _numColumns;
-
-		for (int16 x = subRect.left; x < subRect.right; ++x) {
-			uint32 normalizedX = x - subRect.left;
-			uint32 index = sourceOffset + x;
+		const uint32 *offset = _internalBuffer + y * _numColumns + subRect.left;
 
-			// RenderTable only stores offsets from the original coordinates
-			uint32 sourceYIndex = y + _internalBuffer[index].y;
-			uint32 sourceXIndex = x + _internalBuffer[index].x;
+		for (int16 x = subRect.left; x < subRect.right; ++x)
+			destBuffer[x - subRect.left] = sourceBuffer[*offset++];
 
-			destBuffer[destOffset + normalizedX] = sourceBuffer[sourceYIndex * _numColumns + sourceXIndex];
-		}
-
-		destOffset += destWidth;
+		destBuffer += destWidth;
 	}
 }
 
 void RenderTable::mutateImage(Graphics::Surface *dstBuf, Graphics::Surface *srcBuf) {
-	uint32 destOffset = 0;
+	if (_bilinearWeights) {
+		mutateImageBilinear(dstBuf, srcBuf);
+		return;
+	}
 
-	uint16 *sourceBuffer = (uint16 *)srcBuf->getPixels();
+	const uint16 *sourceBuffer = (const uint16 *)srcBuf->getPixels();
 	uint16 *destBuffer = (uint16 *)dstBuf->getPixels();
 
+	// The table holds the source offset of every destination pixel, so
+	// warping is a single lookup per pixel
 	for (int16 y = 0; y < srcBuf->h; ++y) {
-		uint32 sourceOffset = y * _numColumns;
+		const uint32 *offset = _internalBuffer + y * _numColumns;
 
-		for (int16 x = 0; x < srcBuf->w; ++x) {
-			uint32 index = sourceOffset + x;
+		for (int16 x = 0; x < srcBuf->w; ++x)
+			*destBuffer++ = sourceBuffer[*offset++];
+	}
+}
 
-			// RenderTable only stores offsets from the original coordinates
-			uint32 sourceYIndex = y + _internalBuffer[index].y;
-			uint32 sourceXIndex = x + _internalBuffer[index].x;
+void RenderTable::mutateImageBilinear(Graphics::Surface *dstBuf, Graphics::Surface *srcBuf) {
+	const Graphics::PixelFormat &format = srcBuf->format;
+	const uint16 *sourceBuffer = (const uint16 *)srcBuf->getPixels();
+	uint16 *destBuffer = (uint16 *)dstBuf->getPixels();
+
+	// Pixels are blended with all channels at once by moving green into the
+	// upper half of a 32 bit value, which leaves enough room above every
+	// channel for a 5 bit weight. This works for the RGB555 and RGB565
+	// formats the engine uses.
+	assert(format.bytesPerPixel == 2 && format.gShift + format.gBits() <= 11 &&
+	       MIN(format.rShift, format.bShift) + 5 + 5 <= MAX(format.rShift, format.bShift));
+
+	const uint32 lowMask = ((0xFF >> format.rLoss) << format.rShift) | ((0xFF >> format.bLoss) << format.bShift);
+	const uint32 spreadMask = lowMask | (((0xFF >> format.gLoss) << format.gShift) << 16);
 
-			destBuffer[destOffset] = sourceBuffer[sourceYIndex * _numColumns + sourceXIndex];
-			destOffset++;
+	for (int16 y = 0; y < srcBuf->h; ++y) {
+		const uint32 *offset = _internalBuffer + y * _numColumns;
+		const uint16 *weights = _bilinearWeights + y * _numColumns;
+
+		for (int16 x = 0; x < srcBuf->w; ++x, ++offset, ++weights) {
+			const uint16 *source = sourceBuffer + *offset;
+			const uint32 fx = *weights >> 11;
+			const uint32 fy = (*weights & 0xFF) >> 3;
+
+			if (fx == 0 && fy == 0) {
+				*destBuffer++ = *source;
+				continue;
+			}
+
+			// The weight of a neighbour is 0 if it is outside the image
+			const uint32 c00 = source[0];
+			const uint32 c01 = fx ? source[1] : c00;
+			const uint32 c10 = fy ? source[_numColumns] : c00;
+			const uint32 c11 = fy ? (fx ? source[_numColumns + 1] : c10) : c01;
+
+			const uint32 top = ((((c00 | (c00 << 16)) & spreadMask) * (32 - fx) +
+			                     ((c01 | (c01 << 16)) & spreadMask) * fx) >> 5) & spreadMask;
+			const uint32 bottom = ((((c10 | (c10 << 16)) & spreadMask) * (32 - fx) +
+			                        ((c11 | (c11 << 16)) & spreadMask) * fx) >> 5) & spreadMask;
+			const uint32 result = ((top * (32 - fy) + bottom * fy) >> 5) & spreadMask;
+
+			*destBuffer++ = result | (result >> 16);
 		}
 	}
 }
@@ -138,9 +185,25 @@ void RenderTable::generateRenderTable() {
 	}
 }
 
-void RenderTable::generatePanoramaLookupTable() {
-	memset(_internalBuffer, 0, _numRows * _numColumns * sizeof(uint16));
+void RenderTable::setEntry(uint32 index, float sourceX, float sourceY) {
+	int32 x = int32(floor(sourceX));
+	int32 y = int32(floor(sourceY));
+
+	// Keep the offset inside of the image, so that it can be decoded back
+	// into coordinates and never reads outside of the source buffer
+	const int32 clampedX = CLIP<int32>(x, 0, _numColumns - 1);
+	const int32 clampedY = CLIP<int32>(y, 0, _numRows - 1);
+	_internalBuffer[index] = clampedY * _numColumns + clampedX;
+
+	if (_bilinearWeights) {
+		// Neighbours outside of the image get a weight of 0
+		uint fx = (x == clampedX && x + 1 < (int32)_numColumns) ? uint((sourceX - x) * 256.0f) : 0;
+		uint fy = (y == clampedY && y + 1 < (int32)_numRows) ? uint((sourceY - y) * 256.0f) : 0;
+		_bilinearWeights[index] = (MIN<uint>(fx, 255) << 8) | MIN<uint>(fy, 255);
+	}
+}
 
+void RenderTable::generatePanoramaLookupTable() {
 	float halfWidth = (float)_numColumns / 2.0f;
 	float halfHeight = (float)_numRows / 2.0f;
 
@@ -154,20 +217,16 @@ void RenderTable::generatePanoramaLookupTable() {
 
 		// To get x in cylinder coordinates, we just need to calculate the arc length
 		// We also scale it by _panoramaOptions.linearScale
-		int32 xInCylinderCoords = int32(floor((cylinderRadius * _panoramaOptions.linearScale * alpha) + halfWidth));
+		float xInCylinderCoords = (cylinderRadius * _panoramaOptions.linearScale * alpha) + halfWidth;
 
 		float cosAlpha = cos(alpha);
 
 		for (uint y = 0; y < _numRows; ++y) {
 			// To calculate y in cylinder coordinates, we can do similar triangles comparison,
 			// comparing the triangle from the center to the screen and from the center to the edge of the cylinder
-			int32 yInCylinderCoords = int32(floor(halfHeight + ((float)y - halfHeight) * cosAlpha));
+			float yInCylinderCoords = halfHeight + ((float)y - halfHeight) * cosAlpha;
 
-			uint32 index = y * _numColumns + x;
-
-			// Only store the (x,y) offsets instead of the absolute positions
-			_internalBuffer[index].x = xInCylinderCoords - x;
-			_internalBuffer[index].y = yInCylinderCoords - y;
+			setEntry(y * _numColumns + x, xInCylinderCoords, yInCylinderCoords);
 		}
 	}
 }
@@ -188,7 +247,7 @@ void RenderTable::generateTiltLookupTable() {
 
 		// To get y in cylinder coordinates, we just need to calculate the arc length
 		// We also scale it by _tiltOptions.linearScale
-		int32 yInCylinderCoords = int32(floor((cylinderRadius * _tiltOptions.linearScale * alpha) + halfHeight));
+		float yInCylinderCoords = (cylinderRadius * _tiltOptions.linearScale * alpha) + halfHeight;
 
 		float cosAlpha = cos(alpha);
 		uint32 columnIndex = y * _numColumns;
@@ -196,13 +255,9 @@ void RenderTable::generateTiltLookupTable() {
 		for (uint x = 0; x < _numColumns; ++x) {
 			// To calculate x in cylinder coordinates, we can do similar triangles comparison,
 			// comparing the triangle from the center to the screen and from the center to the edge of the cylinder
-			int32 xInCylinderCoords = int32(floor(halfWidth + ((float)x - halfWidth) * cosAlpha));
-
-			uint32 index = columnIndex + x;
+			float xInCylinderCoords = halfWidth + ((float)x - halfWidth) * cosAlpha;
 
-			// Only store the (x,y) offsets instead of the absolute positions
-			_internalBuffer[index].x = xInCylinderCoords - x;
-			_internalBuffer[index].y = yInCylinderCoords - y;
+			setEntry(columnIndex + x, xInCylinderCoords, yInCylinderCoords);
 		}
 	}
 }
@@ -42,7 +42,17 @@ public:
 
 private:
 	uint _numColumns, _numRows;
-	Common::Point *_internalBuffer;
+	/**
+	 * For every pixel of the warped image, the offset of the pixel of the
+	 * flat image it is taken from
+	 */
+	uint32 *_internalBuffer;
+	/**
+	 * For every pixel of the warped image, the fractional part of the flat
+	 * image coordinates it maps to, with x in the high byte and y in the low
+	 * byte. Only allocated when bilinear filtering is enabled.
+	 */
+	uint16 *_bilinearWeights;
 	RenderState _renderState;
 
 	struct {
@@ -66,6 +76,12 @@ public:
 	}
 	void setRenderState(RenderState newState);
 
+	/**
+	 * Enables blending the four nearest pixels of the flat image for every
+	 * warped pixel, instead of taking the nearest one
+	 */
+	void setBilinearFiltering(bool enable);
+
 	const Common::Point convertWarpedCoordToFlatCoord(const Common::Point &point);
 
 	void mutateImage(uint16 *sourceBuffer, uint16 *destBuffer, uint32 destWidth, const Common::Rect &subRect);
@@ -90,6 +106,8 @@ public:
 private:
 	void generatePanoramaLookupTable();
 	void generateTiltLookupTable();
+	void setEntry(uint32 index, float sourceX, float sourceY);
+	void mutateImageBilinear(Graphics::Surface *dstBuf, Graphics::Surface *srcBuf);
 };
 
 } // End of namespace ZVision
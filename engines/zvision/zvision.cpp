@@ -128,6 +128,8 @@ ZVision::~ZVision() {
 }
 
 void ZVision::registerDefaultSettings() {
+	ConfMan.registerDefault("smoothpanorama", false);
+
 	for (int i = 0; i < ZVISION_SETTINGS_KEYS_COUNT; i++) {
 		if (settingsKeys[i].allowEditing) {
 			if (settingsKeys[i].defaultValue >= 0)
@@ -227,6 +229,7 @@ void ZVision::initialize() {
 	// Create debugger console. It requires GFX to be initialized
 	_console = new Console(this);
 	_doubleFPS = ConfMan.getBool("doublefps");
+	_renderManager->getRenderTable()->setBilinearFiltering(ConfMan.getBool("smoothpanorama"));
 
 	// Initialize FPS timer callback
 	getTimerManager()->installTimerProc(&fpsTimerCallback, 1000000, this, "zvisionFPS");
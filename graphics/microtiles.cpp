@@ -0,0 +1,177 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+
+#include "graphics/microtiles.h"
+
+namespace Graphics {
+
+MicroTileArray::MicroTileArray() :
+	_tiles(nullptr),
+	_width(0),
+	_height(0),
+	_tilesW(0),
+	_tilesH(0),
+	_empty(true) {}
+
+MicroTileArray::MicroTileArray(int16 width, int16 height) :
+	_tiles(nullptr),
+	_width(0),
+	_height(0),
+	_tilesW(0),
+	_tilesH(0),
+	_empty(true) {
+	init(width, height);
+}
+
+MicroTileArray::~MicroTileArray() {
+	delete[] _tiles;
+}
+
+void MicroTileArray::init(int16 width, int16 height) {
+	if (_tiles != nullptr && width == _width && height == _height) {
+		return;
+	}
+
+	delete[] _tiles;
+	_width = width;
+	_height = height;
+	_tilesW = (width + kTileSize - 1) / kTileSize;
+	_tilesH = (height + kTileSize - 1) / kTileSize;
+	_tiles = new BoundingBox[_tilesW * _tilesH];
+	_empty = false;
+	clear();
+}
+
+void MicroTileArray::clear() {
+	if (_empty) {
+		return;
+	}
+
+	for (int i = 0; i < _tilesW * _tilesH; ++i) {
+		_tiles[i] = kEmptyBoundingBox;
+	}
+	_empty = true;
+}
+
+void MicroTileArray::addRect(const Common::Rect &r) {
+	Common::Rect rect(r);
+	rect.clip(Common::Rect(_width, _height));
+	if (rect.isEmpty()) {
+		return;
+	}
+
+	_empty = false;
+
+	// Coordinates of the first and last tile, and of the first and last pixel
+	// inside of those tiles
+	const int tx0 = rect.left / kTileSize;
+	const int ty0 = rect.top / kTileSize;
+	const int tx1 = (rect.right - 1) / kTileSize;
+	const int ty1 = (rect.bottom - 1) / kTileSize;
+	const int px0 = rect.left % kTileSize;
+	const int py0 = rect.top % kTileSize;
+	const int px1 = (rect.right - 1) % kTileSize;
+	const int py1 = (rect.bottom - 1) % kTileSize;
+
+	for (int ty = ty0; ty <= ty1; ++ty) {
+		const int y0 = (ty == ty0) ? py0 : 0;
+		const int y1 = (ty == ty1) ? py1 : kTileSize - 1;
+		BoundingBox *tile = _tiles + ty * _tilesW + tx0;
+
+		for (int tx = tx0; tx <= tx1; ++tx, ++tile) {
+			const int x0 = (tx == tx0) ? px0 : 0;
+			const int x1 = (tx == tx1) ? px1 : kTileSize - 1;
+			updateBoundingBox(*tile, x0, y0, x1, y1);
+		}
+	}
+}
+
+void MicroTileArray::getRectangles(Common::Array<Common::Rect> &rects) const {
+	if (_empty) {
+		return;
+	}
+
+	// Indexes of the rects from the previous row of tiles that reach the
+	// bottom of that row, and so might continue into the current row.
+	// Both lists are sorted from left to right.
+	Common::Array<uint> openRects, nextOpenRects;
+
+	const BoundingBox *tile = _tiles;
+	for (int ty = 0; ty < _tilesH; ++ty) {
+		const int16 rowTop = ty * kTileSize;
+		const int16 rowBottom = MIN<int16>(rowTop + kTileSize, _height);
+		uint openIndex = 0;
+		nextOpenRects.clear();
+
+		for (int tx = 0; tx < _tilesW; ++tx, ++tile) {
+			const BoundingBox boundingBox = *tile;
+			if (boundingBox == kEmptyBoundingBox) {
+				continue;
+			}
+
+			// Merge with the following tiles while the box runs into them
+			// with the same vertical extent
+			int lastTx = tx;
+			while (tileX1(tile[lastTx - tx]) == kTileSize - 1 && lastTx + 1 < _tilesW) {
+				const BoundingBox next = tile[lastTx - tx + 1];
+				if (next == kEmptyBoundingBox || tileX0(next) != 0 ||
+					tileY0(next) != tileY0(boundingBox) || tileY1(next) != tileY1(boundingBox)) {
+					break;
+				}
+				++lastTx;
+			}
+
+			Common::Rect rect(tx * kTileSize + tileX0(boundingBox),
+							  rowTop + tileY0(boundingBox),
+							  lastTx * kTileSize + tileX1(tile[lastTx - tx]) + 1,
+							  rowTop + tileY1(boundingBox) + 1);
+
+			tile += lastTx - tx;
+			tx = lastTx;
+
+			// Extend a rect with the same horizontal extent from the row
+			// above if both touch
+			while (openIndex < openRects.size() && rects[openRects[openIndex]].left < rect.left) {
+				++openIndex;
+			}
+
+			uint index;
+			if (rect.top == rowTop && openIndex < openRects.size() &&
+				rects[openRects[openIndex]].left == rect.left &&
+				rects[openRects[openIndex]].right == rect.right) {
+				index = openRects[openIndex++];
+				rects[index].bottom = rect.bottom;
+			} else {
+				index = rects.size();
+				rects.push_back(rect);
+			}
+
+			if (rect.bottom == rowBottom) {
+				nextOpenRects.push_back(index);
+			}
+		}
+
+		openRects = nextOpenRects;
+	}
+}
+
+} // End of namespace Graphics
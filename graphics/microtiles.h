@@ -0,0 +1,120 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+
+#ifndef GRAPHICS_MICROTILES_H
+#define GRAPHICS_MICROTILES_H
+
+#include "common/array.h"
+#include "common/noncopyable.h"
+#include "common/rect.h"
+
+namespace Graphics {
+
+/**
+ * Tracks the modified areas of a surface by splitting it into a grid of
+ * fixed-size tiles, each of which stores the bounding box of everything
+ * that was marked dirty inside of it.
+ *
+ * Adding a rect only updates the tiles it covers, no matter how many rects
+ * have already been added, and getRectangles() turns the tiles back into a
+ * list of non-overlapping rects, merging neighbouring tiles whose boxes line
+ * up. The result can cover slightly more pixels than were actually added,
+ * but never more than a tile's worth around every dirty area.
+ */
+class MicroTileArray : Common::NonCopyable {
+public:
+	enum {
+		kTileSize = 32
+	};
+
+	MicroTileArray();
+	MicroTileArray(int16 width, int16 height);
+	~MicroTileArray();
+
+	/**
+	 * Sets the size of the area covered by the tiles. Clears all tiles if
+	 * the size changes.
+	 */
+	void init(int16 width, int16 height);
+
+	/**
+	 * Marks the given rect as dirty. Parts of the rect outside of the area
+	 * covered by the tiles are ignored.
+	 */
+	void addRect(const Common::Rect &r);
+
+	/**
+	 * Marks every tile as clean.
+	 */
+	void clear();
+
+	/**
+	 * Returns true if nothing has been marked dirty since the last clear.
+	 */
+	bool isEmpty() const { return _empty; }
+
+	/**
+	 * Appends the non-overlapping rects that cover all dirty areas to the
+	 * given array, from top to bottom and left to right.
+	 */
+	void getRectangles(Common::Array<Common::Rect> &rects) const;
+
+private:
+	/**
+	 * The dirty area of a tile, packed as the left, top, right and bottom
+	 * coordinates relative to the tile in that order, from the most to the
+	 * least significant byte. Right and bottom are inclusive.
+	 */
+	typedef uint32 BoundingBox;
+
+	enum {
+		kEmptyBoundingBox = 0xFFFFFFFF,
+		kFullBoundingBox  = ((kTileSize - 1) << 8) | (kTileSize - 1)
+	};
+
+	BoundingBox *_tiles;
+	int16 _width, _height;
+	int16 _tilesW, _tilesH;
+	bool _empty;
+
+	static inline int tileX0(const BoundingBox boundingBox) { return (boundingBox >> 24) & 0xFF; }
+	static inline int tileY0(const BoundingBox boundingBox) { return (boundingBox >> 16) & 0xFF; }
+	static inline int tileX1(const BoundingBox boundingBox) { return (boundingBox >> 8) & 0xFF; }
+	static inline int tileY1(const BoundingBox boundingBox) { return boundingBox & 0xFF; }
+
+	static inline BoundingBox makeBoundingBox(const int x0, const int y0, const int x1, const int y1) {
+		return (x0 << 24) | (y0 << 16) | (x1 << 8) | y1;
+	}
+
+	static inline void updateBoundingBox(BoundingBox &boundingBox, const int x0, const int y0, const int x1, const int y1) {
+		if (boundingBox == kEmptyBoundingBox) {
+			boundingBox = makeBoundingBox(x0, y0, x1, y1);
+		} else if (boundingBox != kFullBoundingBox) {
+			boundingBox = makeBoundingBox(MIN(tileX0(boundingBox), x0), MIN(tileY0(boundingBox), y0),
+										  MAX(tileX1(boundingBox), x1), MAX(tileY1(boundingBox), y1));
+		}
+	}
+};
+
+} // End of namespace Graphics
+
+#endif
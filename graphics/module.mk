@@ -21,6 +21,7 @@ MODULE_OBJS := \
 	macgui/macwindowborder.o \
 	macgui/macwindowmanager.o \
 	managed_surface.o \
+	microtiles.o \
 	nine_patch.o \
 	pixelformat.o \
 	primitives.o \
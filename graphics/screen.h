@@ -24,8 +24,9 @@
 #define GRAPHICS_SCREEN_H
 
 #include "graphics/managed_surface.h"
+#include "graphics/microtiles.h"
 #include "graphics/pixelformat.h"
-#include "common/list.h"
+#include "common/array.h"
 #include "common/rect.h"
 
 namespace Graphics {
@@ -42,19 +43,14 @@ namespace Graphics {
 class Screen : public ManagedSurface {
 private:
 	/**
-	 * List of affected areas of the screen
+	 * Affected areas of the screen
 	 */
-	Common::List<Common::Rect> _dirtyRects;
-private:
-	/**
-	* Merges together overlapping dirty areas of the screen
-	*/
-	void mergeDirtyRects();
+	MicroTileArray _dirtyTiles;
 
 	/**
-	* Returns the union of two dirty area rectangles
-	*/
-	bool unionRectangle(Common::Rect &destRect, const Common::Rect &src1, const Common::Rect &src2);
+	 * Non-overlapping rects covering the affected areas, rebuilt by update
+	 */
+	Common::Array<Common::Rect> _updateRects;
 protected:
 	/**
 	 * Adds a rectangle to the list of modified areas of the screen during the
@@ -69,7 +65,7 @@ public:
 	/**
 	 * Returns true if there are any pending screen updates (dirty areas)
 	 */
-	bool isDirty() const { return !_dirtyRects.empty(); }
+	bool isDirty() const { return !_dirtyTiles.isEmpty(); }
 
 	/**
 	 * Marks the whole screen as dirty. This forces the next call to update
@@ -80,7 +76,7 @@ public:
 	/**
 	 * Clear the current dirty rects list
 	 */
-	virtual void clearDirtyRects() { _dirtyRects.clear(); }
+	virtual void clearDirtyRects() { _dirtyTiles.clear(); }
 
 	/**
 	 * Updates the screen by copying any affected areas to the system
@@ -83,6 +83,7 @@
 // BASIS, AND BROWN UNIVERSITY HAS NO OBLIGATION TO PROVIDE MAINTENANCE,
 // SUPPORT, UPDATES, ENHANCEMENTS, OR MODIFICATIONS.
 
+#include "common/array.h"
 #include "graphics/surface.h"
 #include "graphics/yuv_to_rgb.h"
 
@@ -298,19 +299,9 @@ void YUVToRGBManager::convert420(Graphics::Surface *dst, YUVToRGBManager::Lumina
 		convertYUV420ToRGB<uint32>((byte *)dst->getPixels(), dst->pitch, lookup, _colorTab, ySrc, uSrc, vSrc, yWidth, yHeight, yPitch, uvPitch);
 }
 
-#define READ_QUAD(ptr, prefix) \
-	byte prefix##A = ptr[index]; \
-	byte prefix##B = ptr[index + 1]; \
-	byte prefix##C = ptr[index + uvPitch]; \
-	byte prefix##D = ptr[index + uvPitch + 1]
-
-#define DO_INTERPOLATION(out) \
-	out = (out##A * (4 - xDiff) * (4 - yDiff) + out##B * xDiff * (4 - yDiff) + \
-			out##C * yDiff * (4 - xDiff) + out##D * xDiff * yDiff) >> 4
-
 #define DO_YUV410_PIXEL() \
-	DO_INTERPOLATION(u); \
-	DO_INTERPOLATION(v); \
+	u = (uLeft * (4 - xDiff) + uRight * xDiff) >> 4; \
+	v = (vLeft * (4 - xDiff) + vRight * xDiff) >> 4; \
 	\
 	cr_r  = Cr_r_tab[v]; \
 	crb_g = Cr_g_tab[v] + Cb_g_tab[u]; \
@@ -333,24 +324,42 @@ void convertYUV410ToRGB(byte *dstPtr, int dstPitch, const YUVToRGBLookup *lookup
 
 	int quarterWidth = yWidth >> 2;
 
+	// The chroma values are bilinearly interpolated. Based on the algorithm
+	// found here: http://tech-algorithm.com/articles/bilinear-image-scaling/
+	// The interpolation is separable, so every row is first interpolated
+	// vertically for a whole line of chroma samples, which leaves only the
+	// horizontal interpolation to be done for each pixel. Like the original
+	// quad-based interpolation, this reads one chroma sample past the right
+	// edge of the chroma planes, and one row past the bottom edge.
+	Common::Array<uint16> uLine(quarterWidth + 1);
+	Common::Array<uint16> vLine(quarterWidth + 1);
+
 	for (int y = 0; y < yHeight; y++) {
-		for (int x = 0; x < quarterWidth; x++) {
-			// Perform bilinear interpolation on the the chroma values
-			// Based on the algorithm found here: http://tech-algorithm.com/articles/bilinear-image-scaling/
-			// Feel free to optimize further
-			int targetY = y >> 2;
-			int xDiff = 0;
-			int yDiff = y & 3;
-			int index = targetY * uvPitch + x;
+		const int yDiff = y & 3;
+		const byte *uRow = uSrc + (y >> 2) * uvPitch;
+		const byte *vRow = vSrc + (y >> 2) * uvPitch;
+
+		if (yDiff == 0) {
+			for (int x = 0; x <= quarterWidth; x++) {
+				uLine[x] = uRow[x] << 2;
+				vLine[x] = vRow[x] << 2;
+			}
+		} else {
+			for (int x = 0; x <= quarterWidth; x++) {
+				uLine[x] = uRow[x] * (4 - yDiff) + uRow[x + uvPitch] * yDiff;
+				vLine[x] = vRow[x] * (4 - yDiff) + vRow[x + uvPitch] * yDiff;
+			}
+		}
 
+		for (int x = 0; x < quarterWidth; x++) {
 			// Declare some variables for the following macros
+			const uint16 uLeft = uLine[x], uRight = uLine[x + 1];
+			const uint16 vLeft = vLine[x], vRight = vLine[x + 1];
+			int xDiff = 0;
 			byte u, v;
 			int16 cr_r, crb_g, cb_b;
 			const uint32 *L;
 
-			READ_QUAD(uSrc, u);
-			READ_QUAD(vSrc, v);
-
 			DO_YUV410_PIXEL();
 			DO_YUV410_PIXEL();
 			DO_YUV410_PIXEL();
@@ -362,8 +371,6 @@ void convertYUV410ToRGB(byte *dstPtr, int dstPitch, const YUVToRGBLookup *lookup
 	}
 }
 
-#undef READ_QUAD
-#undef DO_INTERPOLATION
 #undef DO_YUV410_PIXEL
 
 void YUVToRGBManager::convert410(Graphics::Surface *dst, YUVToRGBManager::LuminanceScale scale, const byte *ySrc, const byte *uSrc, const byte *vSrc, int yWidth, int yHeight, int yPitch, int uvPitch) {
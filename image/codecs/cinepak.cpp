@@ -130,137 +130,123 @@ struct CodebookConverterRaw {
 };
 
 /**
- * Codebook converter that dithers in VFW-style
+ * Look up the palette index for a packed VFW dither color
+ */
+inline byte getRGBLookupEntry(const byte *colorMap, uint16 index) {
+	return colorMap[s_defaultPaletteLookup[CLIP<int>(index, 0, 1023)]];
+}
+
+/**
+ * Dither a v4 codebook entry in VFW-style into a 4x4 block of palette indexes
+ */
+inline void ditherCodebookDetail(const CinepakCodebook &codebook, byte *dst, const byte *colorMap) {
+	int uLookup = (byte)codebook.u * 2;
+	int vLookup = (byte)codebook.v * 2;
+	uint32 uv1 = s_uLookup[uLookup] | s_vLookup[vLookup];
+	uint32 uv2 = s_uLookup[uLookup + 1] | s_vLookup[vLookup + 1];
+
+	int yLookup1 = codebook.y[0] * 2;
+	int yLookup2 = codebook.y[1] * 2;
+	int yLookup3 = codebook.y[2] * 2;
+	int yLookup4 = codebook.y[3] * 2;
+
+	uint32 pixelGroup1 = uv2 | s_yLookup[yLookup1 + 1];
+	uint32 pixelGroup2 = uv2 | s_yLookup[yLookup2 + 1];
+	uint32 pixelGroup3 = uv1 | s_yLookup[yLookup3];
+	uint32 pixelGroup4 = uv1 | s_yLookup[yLookup4];
+	uint32 pixelGroup5 = uv1 | s_yLookup[yLookup1];
+	uint32 pixelGroup6 = uv1 | s_yLookup[yLookup2];
+	uint32 pixelGroup7 = uv2 | s_yLookup[yLookup3 + 1];
+	uint32 pixelGroup8 = uv2 | s_yLookup[yLookup4 + 1];
+
+	dst[0] = getRGBLookupEntry(colorMap, pixelGroup1 & 0xFFFF);
+	dst[1] = getRGBLookupEntry(colorMap, pixelGroup2 >> 16);
+	dst[2] = getRGBLookupEntry(colorMap, pixelGroup5 & 0xFFFF);
+	dst[3] = getRGBLookupEntry(colorMap, pixelGroup6 >> 16);
+	dst[4] = getRGBLookupEntry(colorMap, pixelGroup3 & 0xFFFF);
+	dst[5] = getRGBLookupEntry(colorMap, pixelGroup4 >> 16);
+	dst[6] = getRGBLookupEntry(colorMap, pixelGroup7 & 0xFFFF);
+	dst[7] = getRGBLookupEntry(colorMap, pixelGroup8 >> 16);
+	dst[8] = getRGBLookupEntry(colorMap, pixelGroup1 >> 16);
+	dst[9] = getRGBLookupEntry(colorMap, pixelGroup6 & 0xFFFF);
+	dst[10] = getRGBLookupEntry(colorMap, pixelGroup5 >> 16);
+	dst[11] = getRGBLookupEntry(colorMap, pixelGroup2 & 0xFFFF);
+	dst[12] = getRGBLookupEntry(colorMap, pixelGroup3 >> 16);
+	dst[13] = getRGBLookupEntry(colorMap, pixelGroup8 & 0xFFFF);
+	dst[14] = getRGBLookupEntry(colorMap, pixelGroup7 >> 16);
+	dst[15] = getRGBLookupEntry(colorMap, pixelGroup4 & 0xFFFF);
+}
+
+/**
+ * Dither a v1 codebook entry in VFW-style into a 4x4 block of palette indexes
+ */
+inline void ditherCodebookSmooth(const CinepakCodebook &codebook, byte *dst, const byte *colorMap) {
+	int uLookup = (byte)codebook.u * 2;
+	int vLookup = (byte)codebook.v * 2;
+	uint32 uv1 = s_uLookup[uLookup] | s_vLookup[vLookup];
+	uint32 uv2 = s_uLookup[uLookup + 1] | s_vLookup[vLookup + 1];
+
+	int yLookup1 = codebook.y[0] * 2;
+	int yLookup2 = codebook.y[1] * 2;
+	int yLookup3 = codebook.y[2] * 2;
+	int yLookup4 = codebook.y[3] * 2;
+
+	uint32 pixelGroup1 = uv2 | s_yLookup[yLookup1 + 1];
+	uint32 pixelGroup2 = uv1 | s_yLookup[yLookup2];
+	uint32 pixelGroup3 = uv1 | s_yLookup[yLookup1];
+	uint32 pixelGroup4 = uv2 | s_yLookup[yLookup2 + 1];
+	uint32 pixelGroup5 = uv2 | s_yLookup[yLookup3 + 1];
+	uint32 pixelGroup6 = uv1 | s_yLookup[yLookup3];
+	uint32 pixelGroup7 = uv1 | s_yLookup[yLookup4];
+	uint32 pixelGroup8 = uv2 | s_yLookup[yLookup4 + 1];
+
+	dst[0] = getRGBLookupEntry(colorMap, pixelGroup1 & 0xFFFF);
+	dst[1] = getRGBLookupEntry(colorMap, pixelGroup1 >> 16);
+	dst[2] = getRGBLookupEntry(colorMap, pixelGroup2 & 0xFFFF);
+	dst[3] = getRGBLookupEntry(colorMap, pixelGroup2 >> 16);
+	dst[4] = getRGBLookupEntry(colorMap, pixelGroup3 & 0xFFFF);
+	dst[5] = getRGBLookupEntry(colorMap, pixelGroup3 >> 16);
+	dst[6] = getRGBLookupEntry(colorMap, pixelGroup4 & 0xFFFF);
+	dst[7] = getRGBLookupEntry(colorMap, pixelGroup4 >> 16);
+	dst[8] = getRGBLookupEntry(colorMap, pixelGroup5 >> 16);
+	dst[9] = getRGBLookupEntry(colorMap, pixelGroup6 & 0xFFFF);
+	dst[10] = getRGBLookupEntry(colorMap, pixelGroup7 >> 16);
+	dst[11] = getRGBLookupEntry(colorMap, pixelGroup8 & 0xFFFF);
+	dst[12] = getRGBLookupEntry(colorMap, pixelGroup6 >> 16);
+	dst[13] = getRGBLookupEntry(colorMap, pixelGroup5 & 0xFFFF);
+	dst[14] = getRGBLookupEntry(colorMap, pixelGroup8 >> 16);
+	dst[15] = getRGBLookupEntry(colorMap, pixelGroup7 & 0xFFFF);
+}
+
+/**
+ * Codebook converter that dithers in VFW-style, using codebooks that were
+ * dithered when they were loaded
  */
 struct CodebookConverterDitherVFW {
 	static inline void decodeBlock1(byte codebookIndex, const CinepakStrip &strip, byte *(&rows)[4], const byte *clipTable, const byte *colorMap, const Graphics::PixelFormat &format) {
-		const CinepakCodebook &codebook = strip.v1_codebook[codebookIndex];
-		byte blockBuffer[16];
-		ditherCodebookSmooth(codebook, blockBuffer, colorMap);
-		rows[0][0] = blockBuffer[0];
-		rows[0][1] = blockBuffer[1];
-		rows[0][2] = blockBuffer[2];
-		rows[0][3] = blockBuffer[3];
-		rows[1][0] = blockBuffer[4];
-		rows[1][1] = blockBuffer[5];
-		rows[1][2] = blockBuffer[6];
-		rows[1][3] = blockBuffer[7];
-		rows[2][0] = blockBuffer[8];
-		rows[2][1] = blockBuffer[9];
-		rows[2][2] = blockBuffer[10];
-		rows[2][3] = blockBuffer[11];
-		rows[3][0] = blockBuffer[12];
-		rows[3][1] = blockBuffer[13];
-		rows[3][2] = blockBuffer[14];
-		rows[3][3] = blockBuffer[15];
+		const byte *colorPtr = strip.v1_dither + (codebookIndex << 4);
+		WRITE_UINT32(rows[0], READ_UINT32(colorPtr));
+		WRITE_UINT32(rows[1], READ_UINT32(colorPtr + 4));
+		WRITE_UINT32(rows[2], READ_UINT32(colorPtr + 8));
+		WRITE_UINT32(rows[3], READ_UINT32(colorPtr + 12));
 	}
 
 	static inline void decodeBlock4(const byte (&codebookIndex)[4], const CinepakStrip &strip, byte *(&rows)[4], const byte *clipTable, const byte *colorMap, const Graphics::PixelFormat &format) {
-		byte blockBuffer[16];
-		ditherCodebookDetail(strip.v4_codebook[codebookIndex[0]], blockBuffer, colorMap);
-		rows[0][0] = blockBuffer[0];
-		rows[0][1] = blockBuffer[1];
-		rows[1][0] = blockBuffer[4];
-		rows[1][1] = blockBuffer[5];
-
-		ditherCodebookDetail(strip.v4_codebook[codebookIndex[1]], blockBuffer, colorMap);
-		rows[0][2] = blockBuffer[2];
-		rows[0][3] = blockBuffer[3];
-		rows[1][2] = blockBuffer[6];
-		rows[1][3] = blockBuffer[7];
-
-		ditherCodebookDetail(strip.v4_codebook[codebookIndex[2]], blockBuffer, colorMap);
-		rows[2][0] = blockBuffer[8];
-		rows[2][1] = blockBuffer[9];
-		rows[3][0] = blockBuffer[12];
-		rows[3][1] = blockBuffer[13];
-
-		ditherCodebookDetail(strip.v4_codebook[codebookIndex[3]], blockBuffer, colorMap);
-		rows[2][2] = blockBuffer[10];
-		rows[2][3] = blockBuffer[11];
-		rows[3][2] = blockBuffer[14];
-		rows[3][3] = blockBuffer[15];
-	}
+		const byte *colorPtr = strip.v4_dither + (codebookIndex[0] << 4);
+		WRITE_UINT16(rows[0] + 0, READ_UINT16(colorPtr + 0));
+		WRITE_UINT16(rows[1] + 0, READ_UINT16(colorPtr + 4));
 
-private:
-	static inline void ditherCodebookDetail(const CinepakCodebook &codebook, byte *dst, const byte *colorMap) {
-		int uLookup = (byte)codebook.u * 2;
-		int vLookup = (byte)codebook.v * 2;
-		uint32 uv1 = s_uLookup[uLookup] | s_vLookup[vLookup];
-		uint32 uv2 = s_uLookup[uLookup + 1] | s_vLookup[vLookup + 1];
-
-		int yLookup1 = codebook.y[0] * 2;
-		int yLookup2 = codebook.y[1] * 2;
-		int yLookup3 = codebook.y[2] * 2;
-		int yLookup4 = codebook.y[3] * 2;
-
-		uint32 pixelGroup1 = uv2 | s_yLookup[yLookup1 + 1];
-		uint32 pixelGroup2 = uv2 | s_yLookup[yLookup2 + 1];
-		uint32 pixelGroup3 = uv1 | s_yLookup[yLookup3];
-		uint32 pixelGroup4 = uv1 | s_yLookup[yLookup4];
-		uint32 pixelGroup5 = uv1 | s_yLookup[yLookup1];
-		uint32 pixelGroup6 = uv1 | s_yLookup[yLookup2];
-		uint32 pixelGroup7 = uv2 | s_yLookup[yLookup3 + 1];
-		uint32 pixelGroup8 = uv2 | s_yLookup[yLookup4 + 1];
-
-		dst[0] = getRGBLookupEntry(colorMap, pixelGroup1 & 0xFFFF);
-		dst[1] = getRGBLookupEntry(colorMap, pixelGroup2 >> 16);
-		dst[2] = getRGBLookupEntry(colorMap, pixelGroup5 & 0xFFFF);
-		dst[3] = getRGBLookupEntry(colorMap, pixelGroup6 >> 16);
-		dst[4] = getRGBLookupEntry(colorMap, pixelGroup3 & 0xFFFF);
-		dst[5] = getRGBLookupEntry(colorMap, pixelGroup4 >> 16);
-		dst[6] = getRGBLookupEntry(colorMap, pixelGroup7 & 0xFFFF);
-		dst[7] = getRGBLookupEntry(colorMap, pixelGroup8 >> 16);
-		dst[8] = getRGBLookupEntry(colorMap, pixelGroup1 >> 16);
-		dst[9] = getRGBLookupEntry(colorMap, pixelGroup6 & 0xFFFF);
-		dst[10] = getRGBLookupEntry(colorMap, pixelGroup5 >> 16);
-		dst[11] = getRGBLookupEntry(colorMap, pixelGroup2 & 0xFFFF);
-		dst[12] = getRGBLookupEntry(colorMap, pixelGroup3 >> 16);
-		dst[13] = getRGBLookupEntry(colorMap, pixelGroup8 & 0xFFFF);
-		dst[14] = getRGBLookupEntry(colorMap, pixelGroup7 >> 16);
-		dst[15] = getRGBLookupEntry(colorMap, pixelGroup4 & 0xFFFF);
-	}
+		colorPtr = strip.v4_dither + (codebookIndex[1] << 4);
+		WRITE_UINT16(rows[0] + 2, READ_UINT16(colorPtr + 2));
+		WRITE_UINT16(rows[1] + 2, READ_UINT16(colorPtr + 6));
 
-	static inline void ditherCodebookSmooth(const CinepakCodebook &codebook, byte *dst, const byte *colorMap) {
-		int uLookup = (byte)codebook.u * 2;
-		int vLookup = (byte)codebook.v * 2;
-		uint32 uv1 = s_uLookup[uLookup] | s_vLookup[vLookup];
-		uint32 uv2 = s_uLookup[uLookup + 1] | s_vLookup[vLookup + 1];
-
-		int yLookup1 = codebook.y[0] * 2;
-		int yLookup2 = codebook.y[1] * 2;
-		int yLookup3 = codebook.y[2] * 2;
-		int yLookup4 = codebook.y[3] * 2;
-
-		uint32 pixelGroup1 = uv2 | s_yLookup[yLookup1 + 1];
-		uint32 pixelGroup2 = uv1 | s_yLookup[yLookup2];
-		uint32 pixelGroup3 = uv1 | s_yLookup[yLookup1];
-		uint32 pixelGroup4 = uv2 | s_yLookup[yLookup2 + 1];
-		uint32 pixelGroup5 = uv2 | s_yLookup[yLookup3 + 1];
-		uint32 pixelGroup6 = uv1 | s_yLookup[yLookup3];
-		uint32 pixelGroup7 = uv1 | s_yLookup[yLookup4];
-		uint32 pixelGroup8 = uv2 | s_yLookup[yLookup4 + 1];
-
-		dst[0] = getRGBLookupEntry(colorMap, pixelGroup1 & 0xFFFF);
-		dst[1] = getRGBLookupEntry(colorMap, pixelGroup1 >> 16);
-		dst[2] = getRGBLookupEntry(colorMap, pixelGroup2 & 0xFFFF);
-		dst[3] = getRGBLookupEntry(colorMap, pixelGroup2 >> 16);
-		dst[4] = getRGBLookupEntry(colorMap, pixelGroup3 & 0xFFFF);
-		dst[5] = getRGBLookupEntry(colorMap, pixelGroup3 >> 16);
-		dst[6] = getRGBLookupEntry(colorMap, pixelGroup4 & 0xFFFF);
-		dst[7] = getRGBLookupEntry(colorMap, pixelGroup4 >> 16);
-		dst[8] = getRGBLookupEntry(colorMap, pixelGroup5 >> 16);
-		dst[9] = getRGBLookupEntry(colorMap, pixelGroup6 & 0xFFFF);
-		dst[10] = getRGBLookupEntry(colorMap, pixelGroup7 >> 16);
-		dst[11] = getRGBLookupEntry(colorMap, pixelGroup8 & 0xFFFF);
-		dst[12] = getRGBLookupEntry(colorMap, pixelGroup6 >> 16);
-		dst[13] = getRGBLookupEntry(colorMap, pixelGroup5 & 0xFFFF);
-		dst[14] = getRGBLookupEntry(colorMap, pixelGroup8 >> 16);
-		dst[15] = getRGBLookupEntry(colorMap, pixelGroup7 & 0xFFFF);
-	}
+		colorPtr = strip.v4_dither + (codebookIndex[2] << 4);
+		WRITE_UINT16(rows[2] + 0, READ_UINT16(colorPtr + 8));
+		WRITE_UINT16(rows[3] + 0, READ_UINT16(colorPtr + 12));
 
-	static inline byte getRGBLookupEntry(const byte *colorMap, uint16 index) {
-		return colorMap[s_defaultPaletteLookup[CLIP<int>(index, 0, 1023)]];
+		colorPtr = strip.v4_dither + (codebookIndex[3] << 4);
+		WRITE_UINT16(rows[2] + 2, READ_UINT16(colorPtr + 10));
+		WRITE_UINT16(rows[3] + 2, READ_UINT16(colorPtr + 14));
 	}
 };
 
@@ -301,11 +287,15 @@ void decodeVectorsTmpl(CinepakFrame &frame, const byte *clipTable, const byte *c
 	PixelInt *iy[4];
 	int32 startPos = stream.pos();
 
+	// The surface can be wider than the frame when decoding into the
+	// caller's output surface
+	const uint pitch = frame.surface->pitch / sizeof(PixelInt);
+
 	for (uint16 y = frame.strips[strip].rect.top; y < frame.strips[strip].rect.bottom; y += 4) {
 		iy[0] = (PixelInt *)frame.surface->getBasePtr(frame.strips[strip].rect.left, + y);
-		iy[1] = iy[0] + frame.width;
-		iy[2] = iy[1] + frame.width;
-		iy[3] = iy[2] + frame.width;
+		iy[1] = iy[0] + pitch;
+		iy[2] = iy[1] + pitch;
+		iy[3] = iy[2] + pitch;
 
 		for (uint16 x = frame.strips[strip].rect.left; x < frame.strips[strip].rect.right; x += 4) {
 			if ((chunkID & 0x01) && !(mask >>= 1)) {
@@ -353,6 +343,7 @@ void decodeVectorsTmpl(CinepakFrame &frame, const byte *clipTable, const byte *c
 CinepakDecoder::CinepakDecoder(int bitsPerPixel) : Codec(), _bitsPerPixel(bitsPerPixel) {
 	_curFrame.surface = 0;
 	_curFrame.strips = 0;
+	_outputSurface = 0;
 	_y = 0;
 	_colorMap = 0;
 	_ditherPalette = 0;
@@ -386,7 +377,8 @@ CinepakDecoder::CinepakDecoder(int bitsPerPixel) : Codec(), _bitsPerPixel(bitsPe
 
 CinepakDecoder::~CinepakDecoder() {
 	if (_curFrame.surface) {
-		_curFrame.surface->free();
+		if (!_outputSurface)
+			_curFrame.surface->free();
 		delete _curFrame.surface;
 	}
 
@@ -421,7 +413,19 @@ const Graphics::Surface *CinepakDecoder::decodeFrame(Common::SeekableReadStream
 
 	if (!_curFrame.surface) {
 		_curFrame.surface = new Graphics::Surface();
-		_curFrame.surface->create(_curFrame.width, _curFrame.height, _pixelFormat);
+
+		if (_outputSurface && _outputSurface->w >= _curFrame.width && _outputSurface->h >= _curFrame.height) {
+			// Decode straight into the caller's surface, cleared like one
+			// we would have created ourselves
+			_curFrame.surface->init(_curFrame.width, _curFrame.height, _outputSurface->pitch, _outputSurface->getPixels(), _pixelFormat);
+
+			byte *dst = (byte *)_curFrame.surface->getPixels();
+			for (uint16 y = 0; y < _curFrame.height; y++, dst += _curFrame.surface->pitch)
+				memset(dst, 0, _curFrame.width * _pixelFormat.bytesPerPixel);
+		} else {
+			_outputSurface = 0;
+			_curFrame.surface->create(_curFrame.width, _curFrame.height, _pixelFormat);
+		}
 	}
 
 	_y = 0;
@@ -434,7 +438,8 @@ const Graphics::Surface *CinepakDecoder::decodeFrame(Common::SeekableReadStream
 				_curFrame.strips[i].v4_codebook[j] = _curFrame.strips[i - 1].v4_codebook[j];
 			}
 
-			// Copy the QuickTime dither tables
+			// Copy the dither tables, which hold the QuickTime dither tables or
+			// the pre-dithered VFW codebooks
 			memcpy(_curFrame.strips[i].v1_dither, _curFrame.strips[i - 1].v1_dither, 256 * 4 * 4 * 4);
 			memcpy(_curFrame.strips[i].v4_dither, _curFrame.strips[i - 1].v4_dither, 256 * 4 * 4 * 4);
 		}
@@ -532,9 +537,12 @@ void CinepakDecoder::loadCodebook(Common::SeekableReadStream &stream, uint16 str
 				codebook[i].v = 0;
 			}
 
-			// Dither the codebook if we're dithering for QuickTime
+			// Dither the codebook once here instead of for every block
+			// that uses it
 			if (_ditherType == kDitherTypeQT)
 				ditherCodebookQT(strip, codebookType, i);
+			else if (_ditherType == kDitherTypeVFW)
+				ditherCodebookVFW(strip, codebookType, i);
 		}
 	}
 }
@@ -597,6 +605,13 @@ void CinepakDecoder::ditherCodebookQT(uint16 strip, byte codebookType, uint16 co
 	}
 }
 
+void CinepakDecoder::ditherCodebookVFW(uint16 strip, byte codebookType, uint16 codebookIndex) {
+	if (codebookType == 1)
+		ditherCodebookSmooth(_curFrame.strips[strip].v1_codebook[codebookIndex], _curFrame.strips[strip].v1_dither + (codebookIndex << 4), _colorMap);
+	else
+		ditherCodebookDetail(_curFrame.strips[strip].v4_codebook[codebookIndex], _curFrame.strips[strip].v4_dither + (codebookIndex << 4), _colorMap);
+}
+
 void CinepakDecoder::decodeVectors(Common::SeekableReadStream &stream, uint16 strip, byte chunkID, uint32 chunkSize) {
 	if (_curFrame.surface->format.bytesPerPixel == 1) {
 		decodeVectorsTmpl<byte, CodebookConverterRaw>(_curFrame, _clipTable, _colorMap, stream, strip, chunkID, chunkSize);
@@ -636,6 +651,16 @@ void CinepakDecoder::setDither(DitherType type, const byte *palette) {
 	}
 }
 
+bool CinepakDecoder::setOutputSurface(Graphics::Surface *surface) {
+	// Every frame builds on the previous one, so the surface can only be
+	// switched before the first frame
+	if (_curFrame.surface || surface->format != _pixelFormat)
+		return false;
+
+	_outputSurface = surface;
+	return true;
+}
+
 byte CinepakDecoder::findNearestRGB(int index) const {
 	int r = s_defaultPalette[index * 3];
 	int g = s_defaultPalette[index * 3 + 1];
@@ -81,6 +81,7 @@ public:
 	bool hasDirtyPalette() const { return _dirtyPalette; }
 	bool canDither(DitherType type) const;
 	void setDither(DitherType type, const byte *palette);
+	bool setOutputSurface(Graphics::Surface *surface);
 
 private:
 	CinepakFrame _curFrame;
@@ -88,6 +89,7 @@ private:
 	int _bitsPerPixel;
 	Graphics::PixelFormat _pixelFormat;
 	byte *_clipTable, *_clipTableBuf;
+	Graphics::Surface *_outputSurface;
 
 	byte *_ditherPalette;
 	bool _dirtyPalette;
@@ -100,6 +102,7 @@ private:
 	byte findNearestRGB(int index) const;
 	void ditherVectors(Common::SeekableReadStream &stream, uint16 strip, byte chunkID, uint32 chunkSize);
 	void ditherCodebookQT(uint16 strip, byte codebookType, uint16 codebookIndex);
+	void ditherCodebookVFW(uint16 strip, byte codebookType, uint16 codebookIndex);
 };
 
 } // End of namespace Image
@@ -46,6 +46,10 @@
 #include "common/endian.h"
 #include "common/textconsole.h"
 
+namespace Common {
+DECLARE_SINGLETON(Image::QuickTimeDitherTableManager);
+}
+
 namespace Image {
 
 namespace {
@@ -70,9 +74,7 @@ inline uint16 makeQuickTimeDitherColor(byte r, byte g, byte b) {
 	return ((r & 0xF8) << 6) | ((g & 0xF8) << 1) | (b >> 4);
 }
 
-} // End of anonymous namespace
-
-byte *Codec::createQuickTimeDitherTable(const byte *palette, uint colorCount) {
+byte *buildQuickTimeDitherTable(const byte *palette, uint colorCount) {
 	byte *buf = new byte[0x10000];
 	memset(buf, 0, 0x10000);
 
@@ -195,6 +197,47 @@ byte *Codec::createQuickTimeDitherTable(const byte *palette, uint colorCount) {
 	return buf;
 }
 
+} // End of anonymous namespace
+
+byte *Codec::createQuickTimeDitherTable(const byte *palette, uint colorCount) {
+	byte *buf = new byte[0x10000];
+	memcpy(buf, QuickTimeDitherTableManager::instance().getTable(palette, colorCount), 0x10000);
+	return buf;
+}
+
+QuickTimeDitherTableManager::~QuickTimeDitherTableManager() {
+	for (Common::List<Table>::iterator it = _tables.begin(); it != _tables.end(); ++it)
+		delete[] it->data;
+}
+
+const byte *QuickTimeDitherTableManager::getTable(const byte *palette, uint colorCount) {
+	assert(colorCount <= 256);
+
+	for (Common::List<Table>::iterator it = _tables.begin(); it != _tables.end(); ++it) {
+		if (it->colorCount == colorCount && !memcmp(it->palette, palette, colorCount * 3)) {
+			// Move the table to the front so it is evicted last
+			if (it != _tables.begin()) {
+				_tables.push_front(*it);
+				_tables.erase(it);
+			}
+
+			return _tables.front().data;
+		}
+	}
+
+	if (_tables.size() >= kMaxTables) {
+		delete[] _tables.back().data;
+		_tables.pop_back();
+	}
+
+	Table table;
+	memcpy(table.palette, palette, colorCount * 3);
+	table.colorCount = colorCount;
+	table.data = buildQuickTimeDitherTable(palette, colorCount);
+	_tables.push_front(table);
+	return table.data;
+}
+
 Codec *createBitmapCodec(uint32 tag, int width, int height, int bitsPerPixel) {
 	switch (tag) {
 	case SWAP_CONSTANT_32(0):
@@ -23,6 +23,9 @@
 #ifndef IMAGE_CODECS_CODEC_H
 #define IMAGE_CODECS_CODEC_H
 
+#include "common/list.h"
+#include "common/singleton.h"
+
 #include "graphics/surface.h"
 #include "graphics/pixelformat.h"
 
@@ -111,12 +114,65 @@ public:
 	 */
 	virtual void setDither(DitherType type, const byte *palette) {}
 
+	/**
+	 * Decode frames into the given surface instead of one owned by the codec.
+	 *
+	 * The surface must use the pixel format of the codec and must not be
+	 * modified by the caller while frames are decoded, since frames may only
+	 * update parts of it. A codec which accepts the surface may still fall
+	 * back to its own surface if a frame turns out to be larger than it.
+	 *
+	 * This must be called before the first frame is decoded.
+	 *
+	 * @return true if the codec will decode into the surface, false otherwise
+	 */
+	virtual bool setOutputSurface(Graphics::Surface *surface) { return false; }
+
 	/**
 	 * Create a dither table, as used by QuickTime codecs.
+	 *
+	 * The table is copied from QuickTimeDitherTableManager, so it is only
+	 * built once for every palette. The caller owns the returned table.
 	 */
 	static byte *createQuickTimeDitherTable(const byte *palette, uint colorCount);
 };
 
+/**
+ * Store for QuickTime dither tables, keyed by the palette they were built
+ * for.
+ *
+ * Building a dither table is expensive, and games that dither their videos
+ * usually use one palette for every video, so the last few tables are kept
+ * around to be reused by the next codec that needs them.
+ */
+class QuickTimeDitherTableManager : public Common::Singleton<QuickTimeDitherTableManager> {
+public:
+	/**
+	 * Get the dither table for the given palette, building it if it is not
+	 * in the store yet. The table is owned by the manager and stays valid
+	 * until the next call.
+	 */
+	const byte *getTable(const byte *palette, uint colorCount);
+
+private:
+	friend class Common::Singleton<SingletonBaseType>;
+	QuickTimeDitherTableManager() {}
+	~QuickTimeDitherTableManager();
+
+	enum {
+		kMaxTables = 4
+	};
+
+	struct Table {
+		byte palette[256 * 3];
+		uint colorCount;
+		byte *data;
+	};
+
+	/** The stored tables, most recently used first. */
+	Common::List<Table> _tables;
+};
+
 /**
  * Create a codec given a bitmap/AVI compression tag.
  */
@@ -1246,6 +1246,7 @@ int IndeoDecoderBase::decodeCodedBlocks(GetBits *gb, IVIBandDesc *band,
 	int numCoeffs = blkSize * blkSize;
 	int colMask = blkSize - 1;
 	int scanPos = -1;
+	bool hasAC = false;
 	int minSize = band->_pitch * (band->_transformSize - 1) +
 		band->_transformSize;
 	int bufSize = band->_pitch * band->_aHeight - offs;
@@ -1298,6 +1299,8 @@ int IndeoDecoderBase::decodeCodedBlocks(GetBits *gb, IVIBandDesc *band,
 		trvec[pos] = val;
 		// track columns containing non-zero coeffs
 		colFlags[pos & colMask] |= !!val;
+		if (pos && val)
+			hasAC = true;
 	}
 
 	if (scanPos < 0 || (scanPos >= numCoeffs && sym != rvmap->_eobSym))
@@ -1315,9 +1318,14 @@ int IndeoDecoderBase::decodeCodedBlocks(GetBits *gb, IVIBandDesc *band,
 		return -1;
 	}
 
-	// apply inverse transform
-	band->_invTransform(trvec, band->_buf + offs,
-		band->_pitch, colFlags);
+	// apply inverse transform; a 2D transform of a block with only a DC
+	// coefficient gives the same result as the much cheaper DC transform
+	if (!hasAC && band->_is2dTrans)
+		band->_dcTransform(trvec, band->_buf + offs,
+			band->_pitch, band->_transformSize);
+	else
+		band->_invTransform(trvec, band->_buf + offs,
+			band->_pitch, colFlags);
 
 	// apply motion compensation
 	if (!isIntra)
@@ -211,4 +211,29 @@ public:
 		tmpl_peek_bits_lsb<Common::MemoryReadStream, Common::BitStream8LSB>();
 		tmpl_peek_bits_lsb<Common::BitStreamMemoryStream, Common::BitStreamMemory8LSB>();
 	}
+
+private:
+	template<class MS, class BS>
+	void tmpl_get_bits_32() {
+		byte contents[] = { 0x78, 0x56, 0x34, 0x12, 0xf0, 0xde, 0xbc, 0x9a };
+
+		MS ms(contents, sizeof(contents));
+
+		BS bs(ms);
+		TS_ASSERT_EQUALS(bs.getBits(32), 0x12345678u);
+		TS_ASSERT_EQUALS(bs.getBits(4), 0x0u);
+		TS_ASSERT_EQUALS(bs.pos(), 36u);
+		bs.rewind();
+		TS_ASSERT_EQUALS(bs.getBits(4), 0x8u);
+		TS_ASSERT_EQUALS(bs.getBits(32), 0x01234567u);
+		TS_ASSERT_EQUALS(bs.pos(), 36u);
+		bs.skip(20);
+		TS_ASSERT_EQUALS(bs.getBits(8), 0x9au);
+		TS_ASSERT(bs.eos());
+	}
+public:
+	void test_get_bits_32() {
+		tmpl_get_bits_32<Common::MemoryReadStream, Common::BitStream32LELSB>();
+		tmpl_get_bits_32<Common::BitStreamMemoryStream, Common::BitStreamMemory32LELSB>();
+	}
 };
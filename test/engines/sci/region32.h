@@ -0,0 +1,123 @@
+#include <cxxtest/TestSuite.h>
+
+#include "common/array.h"
+#include "common/rect.h"
+#include "engines/sci/graphics/region32.h"
+
+class RegionTestSuite : public CxxTest::TestSuite {
+	struct RectArray : public Common::Array<Common::Rect> {
+		void add(const Common::Rect &rect) {
+			push_back(rect);
+		}
+	};
+
+	static RectArray getRects(const Sci::Region &region) {
+		RectArray rects;
+		region.addRectsTo(rects);
+		return rects;
+	}
+
+	static bool rectsOverlap(const RectArray &rects) {
+		for (uint i = 0; i < rects.size(); ++i) {
+			for (uint j = i + 1; j < rects.size(); ++j) {
+				if (rects[i].intersects(rects[j])) {
+					return true;
+				}
+			}
+		}
+		return false;
+	}
+
+	public:
+	void test_empty() {
+		Sci::Region region;
+		TS_ASSERT(region.isEmpty());
+		TS_ASSERT_EQUALS(region.getRectCount(), 0u);
+		TS_ASSERT_EQUALS(region.getArea(), 0u);
+
+		region.add(Common::Rect(5, 5, 5, 10));
+		TS_ASSERT(region.isEmpty());
+
+		region.add(Common::Rect(0, 0, 10, 10));
+		region.subtract(Common::Rect(0, 0, 10, 10));
+		TS_ASSERT(region.isEmpty());
+	}
+
+	void test_union() {
+		Sci::Region region(Common::Rect(0, 0, 10, 10));
+
+		// Contained rect does not change the region
+		region.add(Common::Rect(2, 2, 8, 8));
+		TS_ASSERT_EQUALS(region.getRectCount(), 1u);
+		TS_ASSERT_EQUALS(region.getArea(), 100u);
+
+		// Touching rects with the same height are merged horizontally
+		region.add(Common::Rect(10, 0, 20, 10));
+		TS_ASSERT_EQUALS(region.getRectCount(), 1u);
+		TS_ASSERT_EQUALS(region.getBounds(), Common::Rect(0, 0, 20, 10));
+
+		// ...and with the same width vertically
+		region.add(Common::Rect(0, 10, 20, 15));
+		TS_ASSERT_EQUALS(region.getRectCount(), 1u);
+		TS_ASSERT_EQUALS(region.getArea(), 300u);
+
+		// Overlapping rects are split into non-overlapping bands
+		region.add(Common::Rect(15, 12, 30, 20));
+		TS_ASSERT_EQUALS(region.getArea(), 300u + 10u * 3u + 15u * 5u);
+		TS_ASSERT(!rectsOverlap(getRects(region)));
+		TS_ASSERT_EQUALS(region.getBounds(), Common::Rect(0, 0, 30, 20));
+	}
+
+	void test_subtract() {
+		Sci::Region region(Common::Rect(0, 0, 10, 10));
+		region.subtract(Common::Rect(3, 3, 6, 6));
+
+		TS_ASSERT_EQUALS(region.getArea(), 91u);
+		TS_ASSERT(!region.intersects(Common::Rect(3, 3, 6, 6)));
+		TS_ASSERT(region.intersects(Common::Rect(2, 2, 4, 4)));
+		TS_ASSERT(!region.contains(Common::Rect(2, 2, 4, 4)));
+		TS_ASSERT(region.contains(Common::Rect(0, 0, 10, 3)));
+		TS_ASSERT(region.contains(Common::Rect(6, 0, 10, 10)));
+
+		const RectArray rects = getRects(region);
+		TS_ASSERT_EQUALS(rects.size(), 4u);
+		TS_ASSERT(!rectsOverlap(rects));
+
+		// Filling the hole again restores a single rect
+		region.add(Common::Rect(3, 3, 6, 6));
+		TS_ASSERT_EQUALS(region.getRectCount(), 1u);
+		TS_ASSERT_EQUALS(region.getArea(), 100u);
+	}
+
+	void test_intersect() {
+		Sci::Region region(Common::Rect(0, 0, 10, 10));
+		region.add(Common::Rect(20, 0, 30, 10));
+		region.intersect(Common::Rect(5, 5, 25, 15));
+
+		TS_ASSERT_EQUALS(region.getArea(), 50u);
+		TS_ASSERT_EQUALS(region.getBounds(), Common::Rect(5, 5, 25, 10));
+		TS_ASSERT(!region.intersects(Common::Rect(10, 0, 20, 20)));
+
+		region.intersect(Common::Rect(40, 40, 50, 50));
+		TS_ASSERT(region.isEmpty());
+	}
+
+	void test_many_rects() {
+		// A grid of overlapping rects must still give the exact covered area
+		// with non-overlapping output rects
+		Sci::Region region;
+		for (int y = 0; y < 10; ++y) {
+			for (int x = 0; x < 10; ++x) {
+				region.add(Common::Rect(x * 10, y * 10, x * 10 + 15, y * 10 + 15));
+			}
+		}
+
+		TS_ASSERT_EQUALS(region.getArea(), 105u * 105u);
+		TS_ASSERT_EQUALS(region.getRectCount(), 1u);
+
+		region.subtract(Common::Rect(50, 0, 51, 105));
+		TS_ASSERT_EQUALS(region.getArea(), 104u * 105u);
+		TS_ASSERT_EQUALS(region.getRectCount(), 2u);
+		TS_ASSERT(!rectsOverlap(getRects(region)));
+	}
+};
@@ -0,0 +1,134 @@
+#include <cxxtest/TestSuite.h>
+
+#include "common/array.h"
+#include "common/rect.h"
+#include "graphics/microtiles.h"
+
+class MicroTileArrayTestSuite : public CxxTest::TestSuite {
+private:
+	typedef Common::Array<Common::Rect> RectList;
+
+	enum {
+		kWidth = 100,
+		kHeight = 70
+	};
+
+	// Marks every pixel covered by the given rects in a plain bitmap, failing
+	// if any pixel is covered twice
+	bool rasterize(const RectList &rects, Common::Array<byte> &pixels) {
+		pixels.resize(kWidth * kHeight);
+		for (uint i = 0; i < pixels.size(); ++i) {
+			pixels[i] = 0;
+		}
+
+		for (uint i = 0; i < rects.size(); ++i) {
+			for (int y = rects[i].top; y < rects[i].bottom; ++y) {
+				for (int x = rects[i].left; x < rects[i].right; ++x) {
+					if (pixels[y * kWidth + x])
+						return false;
+					pixels[y * kWidth + x] = 1;
+				}
+			}
+		}
+
+		return true;
+	}
+
+public:
+	void test_empty() {
+		Graphics::MicroTileArray tiles(kWidth, kHeight);
+		TS_ASSERT(tiles.isEmpty());
+
+		tiles.addRect(Common::Rect(200, 200, 300, 300));
+		tiles.addRect(Common::Rect(10, 10, 10, 20));
+		TS_ASSERT(tiles.isEmpty());
+
+		RectList rects;
+		tiles.getRectangles(rects);
+		TS_ASSERT_EQUALS(rects.size(), 0u);
+	}
+
+	void test_single_rect() {
+		Graphics::MicroTileArray tiles(kWidth, kHeight);
+		tiles.addRect(Common::Rect(3, 5, 90, 60));
+		TS_ASSERT(!tiles.isEmpty());
+
+		RectList rects;
+		tiles.getRectangles(rects);
+		TS_ASSERT_EQUALS(rects.size(), 1u);
+		TS_ASSERT_EQUALS(rects[0], Common::Rect(3, 5, 90, 60));
+	}
+
+	void test_clip() {
+		Graphics::MicroTileArray tiles(kWidth, kHeight);
+		tiles.addRect(Common::Rect(-10, -10, 200, 200));
+
+		RectList rects;
+		tiles.getRectangles(rects);
+		TS_ASSERT_EQUALS(rects.size(), 1u);
+		TS_ASSERT_EQUALS(rects[0], Common::Rect(0, 0, kWidth, kHeight));
+	}
+
+	void test_clear() {
+		Graphics::MicroTileArray tiles(kWidth, kHeight);
+		tiles.addRect(Common::Rect(0, 0, 1, 1));
+		tiles.clear();
+		TS_ASSERT(tiles.isEmpty());
+
+		tiles.addRect(Common::Rect(40, 40, 41, 41));
+		RectList rects;
+		tiles.getRectangles(rects);
+		TS_ASSERT_EQUALS(rects.size(), 1u);
+		TS_ASSERT_EQUALS(rects[0], Common::Rect(40, 40, 41, 41));
+	}
+
+	void test_coverage() {
+		Graphics::MicroTileArray tiles(kWidth, kHeight);
+		Common::Array<byte> expected(kWidth * kHeight);
+		for (uint i = 0; i < expected.size(); ++i) {
+			expected[i] = 0;
+		}
+
+		uint32 seed = 1;
+		for (int i = 0; i < 40; ++i) {
+			seed = seed * 1103515245 + 12345;
+			const int16 x = (seed >> 8) % kWidth;
+			const int16 y = (seed >> 16) % kHeight;
+			seed = seed * 1103515245 + 12345;
+			const int16 w = (seed >> 8) % 30 + 1;
+			const int16 h = (seed >> 16) % 30 + 1;
+
+			const Common::Rect rect(x, y, MIN<int16>(x + w, kWidth), MIN<int16>(y + h, kHeight));
+			tiles.addRect(rect);
+			for (int py = rect.top; py < rect.bottom; ++py) {
+				for (int px = rect.left; px < rect.right; ++px) {
+					expected[py * kWidth + px] = 1;
+				}
+			}
+		}
+
+		RectList rects;
+		tiles.getRectangles(rects);
+
+		// The rects must not overlap and must cover every dirty pixel
+		Common::Array<byte> actual;
+		TS_ASSERT(rasterize(rects, actual));
+		for (uint i = 0; i < expected.size(); ++i) {
+			if (expected[i]) {
+				TS_ASSERT_EQUALS(actual[i], 1);
+			}
+		}
+	}
+
+	void test_merge_rows() {
+		// A full-width band spanning several tile rows comes back whole
+		Graphics::MicroTileArray tiles(kWidth, kHeight);
+		tiles.addRect(Common::Rect(0, 10, 64, 20));
+		tiles.addRect(Common::Rect(0, 20, 64, 70));
+
+		RectList rects;
+		tiles.getRectangles(rects);
+		TS_ASSERT_EQUALS(rects.size(), 1u);
+		TS_ASSERT_EQUALS(rects[0], Common::Rect(0, 10, 64, 70));
+	}
+};
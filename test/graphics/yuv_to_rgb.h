@@ -0,0 +1,105 @@
+#include <cxxtest/TestSuite.h>
+
+#include "common/array.h"
+#include "graphics/surface.h"
+#include "graphics/yuv_to_rgb.h"
+
+class YUVToRGBTestSuite : public CxxTest::TestSuite {
+private:
+	enum {
+		kWidth = 32,
+		kHeight = 24
+	};
+
+	typedef Common::Array<byte> Plane;
+
+	// Random planes with one extra row and column of padding, since the
+	// YUV410 conversion reads one chroma sample past the edges
+	void fillPlane(Plane &plane, int size, uint32 &seed) {
+		plane.resize(size);
+		for (int i = 0; i < size; ++i) {
+			seed = seed * 1103515245 + 12345;
+			plane[i] = seed >> 24;
+		}
+	}
+
+	bool surfacesEqual(const Graphics::Surface &a, const Graphics::Surface &b) {
+		for (int y = 0; y < a.h; ++y) {
+			if (memcmp(a.getBasePtr(0, y), b.getBasePtr(0, y), a.w * a.format.bytesPerPixel) != 0)
+				return false;
+		}
+
+		return true;
+	}
+
+	/**
+	 * Converts the given subsampled chroma planes by upsampling them to full
+	 * size and converting them with the YUV444 path, which every other
+	 * subsampling mode must match exactly.
+	 */
+	void convertReference(Graphics::Surface &dst, Graphics::YUVToRGBManager::LuminanceScale scale, const Plane &ySrc, const Plane &uSrc, const Plane &vSrc, int uvPitch, int shift, bool interpolate) {
+		Plane uFull(kWidth * kHeight), vFull(kWidth * kHeight);
+		const int factor = 1 << shift;
+		const int mask = factor - 1;
+
+		for (int y = 0; y < kHeight; ++y) {
+			for (int x = 0; x < kWidth; ++x) {
+				const int index = (y >> shift) * uvPitch + (x >> shift);
+				if (interpolate) {
+					const int xDiff = x & mask;
+					const int yDiff = y & mask;
+					uFull[y * kWidth + x] = (uSrc[index] * (factor - xDiff) * (factor - yDiff) + uSrc[index + 1] * xDiff * (factor - yDiff) +
+					                         uSrc[index + uvPitch] * yDiff * (factor - xDiff) + uSrc[index + uvPitch + 1] * xDiff * yDiff) >> (shift * 2);
+					vFull[y * kWidth + x] = (vSrc[index] * (factor - xDiff) * (factor - yDiff) + vSrc[index + 1] * xDiff * (factor - yDiff) +
+					                         vSrc[index + uvPitch] * yDiff * (factor - xDiff) + vSrc[index + uvPitch + 1] * xDiff * yDiff) >> (shift * 2);
+				} else {
+					uFull[y * kWidth + x] = uSrc[index];
+					vFull[y * kWidth + x] = vSrc[index];
+				}
+			}
+		}
+
+		YUVToRGBMan.convert444(&dst, scale, ySrc.begin(), uFull.begin(), vFull.begin(), kWidth, kHeight, kWidth, kWidth);
+	}
+
+	void testConversion(const Graphics::PixelFormat &format, Graphics::YUVToRGBManager::LuminanceScale scale, int shift, bool interpolate) {
+		uint32 seed = 1;
+		const int uvPitch = (kWidth >> shift) + 1;
+		Plane ySrc, uSrc, vSrc;
+		fillPlane(ySrc, kWidth * kHeight, seed);
+		fillPlane(uSrc, uvPitch * ((kHeight >> shift) + 1), seed);
+		fillPlane(vSrc, uvPitch * ((kHeight >> shift) + 1), seed);
+
+		Graphics::Surface expected, actual;
+		expected.create(kWidth, kHeight, format);
+		actual.create(kWidth, kHeight, format);
+
+		convertReference(expected, scale, ySrc, uSrc, vSrc, uvPitch, shift, interpolate);
+		if (shift == 1)
+			YUVToRGBMan.convert420(&actual, scale, ySrc.begin(), uSrc.begin(), vSrc.begin(), kWidth, kHeight, kWidth, uvPitch);
+		else
+			YUVToRGBMan.convert410(&actual, scale, ySrc.begin(), uSrc.begin(), vSrc.begin(), kWidth, kHeight, kWidth, uvPitch);
+
+		TS_ASSERT(surfacesEqual(expected, actual));
+
+		expected.free();
+		actual.free();
+	}
+
+	static Graphics::PixelFormat format16() { return Graphics::PixelFormat(2, 5, 6, 5, 0, 11, 5, 0, 0); }
+	static Graphics::PixelFormat format32() { return Graphics::PixelFormat(4, 8, 8, 8, 8, 24, 16, 8, 0); }
+
+public:
+	void test_convert420() {
+		testConversion(format16(), Graphics::YUVToRGBManager::kScaleFull, 1, false);
+		testConversion(format32(), Graphics::YUVToRGBManager::kScaleFull, 1, false);
+		testConversion(format32(), Graphics::YUVToRGBManager::kScaleITU, 1, false);
+	}
+
+	void test_convert410() {
+		testConversion(format16(), Graphics::YUVToRGBManager::kScaleFull, 2, true);
+		testConversion(format16(), Graphics::YUVToRGBManager::kScaleITU, 2, true);
+		testConversion(format32(), Graphics::YUVToRGBManager::kScaleFull, 2, true);
+		testConversion(format32(), Graphics::YUVToRGBManager::kScaleITU, 2, true);
+	}
+};
@@ -0,0 +1,86 @@
+#include <cxxtest/TestSuite.h>
+
+#include "common/memstream.h"
+#include "graphics/surface.h"
+#include "image/codecs/cinepak.h"
+
+class CinepakDecoderTestSuite : public CxxTest::TestSuite {
+private:
+	enum {
+		kWidth = 8,
+		kHeight = 8,
+		kOutputWidth = 16,
+		kOutputHeight = 12
+	};
+
+	// An 8x8 palettized frame with a single strip, using one V1 codebook
+	// entry whose 2x2 quadrants have different colors for every block
+	static const byte *getFrame(uint32 &size) {
+		static const byte frame[] = {
+			// Frame header: flags, length, width, height, strip count
+			0x00, 0x00, 0x00, 0x26, 0x00, kWidth, 0x00, kHeight, 0x00, 0x01,
+			// Strip header: ID, length, top, left, bottom, right
+			0x10, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, kHeight, 0x00, kWidth,
+			// V1 codebook without U and V
+			0x26, 0x00, 0x00, 0x08, 10, 20, 30, 40,
+			// Every block uses V1 codebook entry 0
+			0x32, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00
+		};
+
+		size = sizeof(frame);
+		return frame;
+	}
+
+	static byte getExpectedColor(int x, int y) {
+		static const byte colors[] = { 10, 20, 30, 40 };
+		return colors[((y & 3) >= 2 ? 2 : 0) + ((x & 3) >= 2 ? 1 : 0)];
+	}
+
+public:
+	void test_decode() {
+		uint32 size;
+		const byte *data = getFrame(size);
+		Common::MemoryReadStream stream(data, size);
+
+		Image::CinepakDecoder decoder(8);
+		const Graphics::Surface *surface = decoder.decodeFrame(stream);
+		TS_ASSERT(surface);
+		TS_ASSERT_EQUALS(surface->w, kWidth);
+		TS_ASSERT_EQUALS(surface->h, kHeight);
+
+		for (int y = 0; y < kHeight; ++y) {
+			for (int x = 0; x < kWidth; ++x) {
+				TS_ASSERT_EQUALS(*(const byte *)surface->getBasePtr(x, y), getExpectedColor(x, y));
+			}
+		}
+	}
+
+	void test_decode_into_wider_output_surface() {
+		uint32 size;
+		const byte *data = getFrame(size);
+		Common::MemoryReadStream stream(data, size);
+
+		Graphics::Surface output;
+		output.create(kOutputWidth, kOutputHeight, Graphics::PixelFormat::createFormatCLUT8());
+		memset(output.getPixels(), 0xFF, output.pitch * output.h);
+
+		Image::CinepakDecoder decoder(8);
+		TS_ASSERT(decoder.setOutputSurface(&output));
+
+		const Graphics::Surface *surface = decoder.decodeFrame(stream);
+		TS_ASSERT(surface);
+		TS_ASSERT_EQUALS(surface->getPixels(), output.getPixels());
+		TS_ASSERT_EQUALS(surface->pitch, output.pitch);
+
+		// The frame is decoded into the top left corner of the output
+		// surface, and everything else is left alone
+		for (int y = 0; y < kOutputHeight; ++y) {
+			for (int x = 0; x < kOutputWidth; ++x) {
+				const byte expected = (x < kWidth && y < kHeight) ? getExpectedColor(x, y) : 0xFF;
+				TS_ASSERT_EQUALS(*(const byte *)output.getBasePtr(x, y), expected);
+			}
+		}
+
+		output.free();
+	}
+};
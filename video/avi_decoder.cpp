@@ -900,6 +900,7 @@ AVIDecoder::AVIVideoTrack::AVIVideoTrack(int frameCount, const AVIStreamHeader &
 		: _frameCount(frameCount), _vidsHeader(streamHeader), _bmInfo(bitmapInfoHeader), _initialPalette(initialPalette) {
 	_videoCodec = createCodec();
 	_lastFrame = 0;
+	_outputSurface = 0;
 	_curFrame = -1;
 	_reversed = false;
 
@@ -983,6 +984,10 @@ bool AVIDecoder::AVIVideoTrack::rewind() {
 	delete _videoCodec;
 	_videoCodec = createCodec();
 	_lastFrame = 0;
+
+	if (_outputSurface && _videoCodec)
+		_videoCodec->setOutputSurface(_outputSurface);
+
 	return true;
 }
 
@@ -1035,6 +1040,18 @@ void AVIDecoder::AVIVideoTrack::setDither(const byte *palette) {
 	_videoCodec->setDither(Image::Codec::kDitherTypeVFW, palette);
 }
 
+bool AVIDecoder::AVIVideoTrack::setOutputSurface(Graphics::Surface *surface) {
+	if (!_videoCodec || surface->w < getWidth() || surface->h < getHeight())
+		return false;
+
+	if (!_videoCodec->setOutputSurface(surface))
+		return false;
+
+	// Remembered so the codec created on rewind decodes into it as well
+	_outputSurface = surface;
+	return true;
+}
+
 AVIDecoder::AVIAudioTrack::AVIAudioTrack(const AVIStreamHeader &streamHeader, const PCMWaveFormat &waveFormat, Audio::Mixer::SoundType soundType) :
 		AudioTrack(soundType),
 		_audsHeader(streamHeader),
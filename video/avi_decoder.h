@@ -214,6 +214,7 @@ protected:
 		int getCurFrame() const { return _curFrame; }
 		int getFrameCount() const { return _frameCount; }
 		Common::String &getName() { return _vidsHeader.name; }
+		uint32 getCodecTag() const { return _bmInfo.compression; }
 		const Graphics::Surface *decodeNextFrame() { return _lastFrame; }
 
 		const byte *getPalette() const;
@@ -223,6 +224,7 @@ protected:
 		void useInitialPalette();
 		bool canDither() const;
 		void setDither(const byte *palette);
+		bool setOutputSurface(Graphics::Surface *surface);
 
 		bool isTruemotion1() const;
 		void forceDimensions(uint16 width, uint16 height);
@@ -273,6 +275,7 @@ protected:
 
 		Image::Codec *_videoCodec;
 		const Graphics::Surface *_lastFrame;
+		Graphics::Surface *_outputSurface;
 		Image::Codec *createCodec();
 	};
 
@@ -280,6 +280,7 @@ BinkDecoder::BinkVideoTrack::BinkVideoTrack(uint32 width, uint32 height, const G
 	}
 
 	_surface.create(_surfaceWidth, _surfaceHeight, format);
+	_hasOutputSurface = false;
 	// Since we over-allocate to make surfaces even-sized
 	// we need to set the actual VIDEO size back into the
 	// surface.
@@ -329,7 +330,26 @@ BinkDecoder::BinkVideoTrack::~BinkVideoTrack() {
 		_huffman[i] = 0;
 	}
 
-	_surface.free();
+	if (!_hasOutputSurface)
+		_surface.free();
+}
+
+bool BinkDecoder::BinkVideoTrack::setOutputSurface(Graphics::Surface *surface) {
+	// Frames are converted at the even-sized dimensions of the planes, so
+	// the surface needs room for the extra row and column of odd-sized videos
+	if (surface->format != _surface.format || surface->w < _surfaceWidth || surface->h < _surfaceHeight)
+		return false;
+
+	// Every frame is converted from the planes in full, so nothing needs to
+	// be carried over from the old surface
+	const uint16 width = _surface.w;
+	const uint16 height = _surface.h;
+	if (!_hasOutputSurface)
+		_surface.free();
+
+	_surface.init(width, height, surface->pitch, surface->getPixels(), surface->format);
+	_hasOutputSurface = true;
+	return true;
 }
 
 void BinkDecoder::BinkVideoTrack::decodePacket(VideoFrame &frame) {
@@ -829,9 +849,9 @@ void BinkDecoder::BinkVideoTrack::blockIntra(DecodeContext &ctx) {
 
 	block[0] = getBundleValue(kSourceIntraDC);
 
-	readDCTCoeffs(*ctx.video, block, true);
+	const int coefCount = readDCTCoeffs(*ctx.video, block, true);
 
-	IDCTPut(ctx, block);
+	IDCTPut(ctx, block, coefCount);
 }
 
 void BinkDecoder::BinkVideoTrack::blockFill(DecodeContext &ctx) {
@@ -850,9 +870,9 @@ void BinkDecoder::BinkVideoTrack::blockInter(DecodeContext &ctx) {
 
 	block[0] = getBundleValue(kSourceInterDC);
 
-	readDCTCoeffs(*ctx.video, block, false);
+	const int coefCount = readDCTCoeffs(*ctx.video, block, false);
 
-	IDCTAdd(ctx, block);
+	IDCTAdd(ctx, block, coefCount);
 }
 
 void BinkDecoder::BinkVideoTrack::blockPattern(DecodeContext &ctx) {
@@ -1081,7 +1101,7 @@ void BinkDecoder::BinkVideoTrack::readDCS(VideoFrame &video, Bundle &bundle, int
 }
 
 /** Reads 8x8 block of DCT coefficients. */
-void BinkDecoder::BinkVideoTrack::readDCTCoeffs(VideoFrame &video, int16 *block, bool isIntra) {
+int BinkDecoder::BinkVideoTrack::readDCTCoeffs(VideoFrame &video, int16 *block, bool isIntra) {
 	int coefCount = 0;
 	int coefIdx[64];
 
@@ -1177,6 +1197,7 @@ void BinkDecoder::BinkVideoTrack::readDCTCoeffs(VideoFrame &video, int16 *block,
 		block[binkScan[idx]] = (block[binkScan[idx]] * quant[idx]) >> 11;
 	}
 
+	return coefCount;
 }
 
 /** Reads 8x8 block with residue after motion compensation. */
@@ -1323,35 +1344,73 @@ static inline void IDCTCol(int16 *dest, const int16 *src) {
 	}
 }
 
+// A row without AC coefficients transforms to eight copies of its rounded DC
+// value, the same as the column shortcut above. Most rows of typical blocks
+// are like this after the column pass.
+template<typename T>
+static inline void IDCTRow(T *dest, const int16 *src) {
+	if ((src[1] | src[2] | src[3] | src[4] | src[5] | src[6] | src[7]) == 0) {
+		const T dc = MUNGE_ROW(src[0]);
+		dest[0] = dest[1] = dest[2] = dest[3] = dest[4] = dest[5] = dest[6] = dest[7] = dc;
+	} else {
+		IDCT_ROW(dest, src);
+	}
+}
+
 void BinkDecoder::BinkVideoTrack::IDCT(int16 *block) {
 	int i;
 	int16 temp[64];
 
 	for (i = 0; i < 8; i++)
 		IDCTCol(&temp[i], &block[i]);
-	for (i = 0; i < 8; i++) {
-		IDCT_ROW( (&block[8*i]), (&temp[8*i]) );
-	}
+	for (i = 0; i < 8; i++)
+		IDCTRow(&block[8*i], &temp[8*i]);
 }
 
-void BinkDecoder::BinkVideoTrack::IDCTAdd(DecodeContext &ctx, int16 *block) {
+void BinkDecoder::BinkVideoTrack::IDCTAdd(DecodeContext &ctx, int16 *block, int coefCount) {
 	int i, j;
-
-	IDCT(block);
 	byte *dest = ctx.dest;
-	for (i = 0; i < 8; i++, dest += ctx.pitch, block += 8)
+
+	if (coefCount == 0) {
+		// Only the DC coefficient is set, so the whole block transforms to
+		// one value
+		const int16 dc = MUNGE_ROW(block[0]);
+		for (i = 0; i < 8; i++, dest += ctx.pitch)
+			for (j = 0; j < 8; j++)
+				dest[j] += dc;
+		return;
+	}
+
+	int16 temp[64];
+	for (i = 0; i < 8; i++)
+		IDCTCol(&temp[i], &block[i]);
+
+	// The row pass feeds the residue straight into the destination instead of
+	// going through the block buffer again
+	int16 row[8];
+	for (i = 0; i < 8; i++, dest += ctx.pitch) {
+		IDCTRow(row, &temp[8*i]);
 		for (j = 0; j < 8; j++)
-			 dest[j] += block[j];
+			dest[j] += row[j];
+	}
 }
 
-void BinkDecoder::BinkVideoTrack::IDCTPut(DecodeContext &ctx, int16 *block) {
+void BinkDecoder::BinkVideoTrack::IDCTPut(DecodeContext &ctx, int16 *block, int coefCount) {
 	int i;
+	byte *dest = ctx.dest;
+
+	if (coefCount == 0) {
+		const byte dc = MUNGE_ROW(block[0]);
+		for (i = 0; i < 8; i++, dest += ctx.pitch)
+			memset(dest, dc, 8);
+		return;
+	}
+
 	int16 temp[64];
 	for (i = 0; i < 8; i++)
 		IDCTCol(&temp[i], &block[i]);
-	for (i = 0; i < 8; i++) {
-		IDCT_ROW( (&ctx.dest[i*ctx.pitch]), (&temp[8*i]) );
-	}
+	for (i = 0; i < 8; i++, dest += ctx.pitch)
+		IDCTRow(dest, &temp[8*i]);
 }
 
 BinkDecoder::BinkAudioTrack::BinkAudioTrack(BinkDecoder::AudioInfo &audio, Audio::Mixer::SoundType soundType) :
@@ -150,6 +150,7 @@ private:
 		int getCurFrame() const { return _curFrame; }
 		int getFrameCount() const { return _frameCount; }
 		const Graphics::Surface *decodeNextFrame() { return &_surface; }
+		bool setOutputSurface(Graphics::Surface *surface);
 
 		/** Decode a video packet. */
 		void decodePacket(VideoFrame &frame);
@@ -237,6 +238,7 @@ private:
 		Graphics::Surface _surface;
 		int _surfaceWidth; ///< The actual surface width
 		int _surfaceHeight; ///< The actual surface height
+		bool _hasOutputSurface; ///< Whether _surface refers to pixels owned by the caller
 
 		uint32 _id; ///< The BIK FourCC.
 
@@ -314,13 +316,14 @@ private:
 		void readPatterns    (VideoFrame &video, Bundle &bundle);
 		void readColors      (VideoFrame &video, Bundle &bundle);
 		void readDCS         (VideoFrame &video, Bundle &bundle, int startBits, bool hasSign);
-		void readDCTCoeffs   (VideoFrame &video, int16 *block, bool isIntra);
+		/** Reads DCT coefficients and returns the number of AC coefficients read. */
+		int  readDCTCoeffs   (VideoFrame &video, int16 *block, bool isIntra);
 		void readResidue     (VideoFrame &video, int16 *block, int masksCount);
 
 		// Bink video IDCT
 		void IDCT(int16 *block);
-		void IDCTPut(DecodeContext &ctx, int16 *block);
-		void IDCTAdd(DecodeContext &ctx, int16 *block);
+		void IDCTPut(DecodeContext &ctx, int16 *block, int coefCount);
+		void IDCTAdd(DecodeContext &ctx, int16 *block, int coefCount);
 	};
 
 	class BinkAudioTrack : public AudioTrack {
@@ -171,23 +171,33 @@ void MPEGPSDecoder::readNextPacket() {
 }
 
 #define MAX_SYNC_SIZE 100000
+#define SYNC_BUFFER_SIZE 4096
 
 int MPEGPSDecoder::findNextStartCode(uint32 &size) {
 	size = MAX_SYNC_SIZE;
 	int32 state = 0xFF;
 
+	// Scan a block at a time instead of reading every byte from the stream,
+	// and put back whatever follows the start code
+	byte buffer[SYNC_BUFFER_SIZE];
+
 	while (size > 0) {
-		byte v = _stream->readByte();
+		uint32 bytesRead = _stream->read(buffer, MIN<uint32>(size, SYNC_BUFFER_SIZE));
 
-		if (_stream->eos())
-			return -1;
+		for (uint32 i = 0; i < bytesRead; i++) {
+			byte v = buffer[i];
+			size--;
 
-		size--;
+			if (state == 0x1) {
+				_stream->seek(i + 1 - (int32)bytesRead, SEEK_CUR);
+				return ((state << 8) | v) & 0xFFFFFF;
+			}
 
-		if (state == 0x1)
-			return ((state << 8) | v) & 0xFFFFFF;
+			state = ((state << 8) | v) & 0xFFFFFF;
+		}
 
-		state = ((state << 8) | v) & 0xFFFFFF;
+		if (_stream->eos() || bytesRead == 0)
+			return -1;
 	}
 
 	return -1;
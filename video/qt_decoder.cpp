@@ -401,6 +401,10 @@ Graphics::PixelFormat QuickTimeDecoder::VideoTrackHandler::getPixelFormat() cons
 	return ((VideoSampleDesc *)_parent->sampleDescs[0])->_videoCodec->getPixelFormat();
 }
 
+uint32 QuickTimeDecoder::VideoTrackHandler::getCodecTag() const {
+	return _parent->sampleDescs.empty() ? 0 : _parent->sampleDescs[0]->getCodecTag();
+}
+
 int QuickTimeDecoder::VideoTrackHandler::getFrameCount() const {
 	return _parent->frameCount;
 }
@@ -573,48 +577,12 @@ Common::Rational QuickTimeDecoder::VideoTrackHandler::getScaledHeight() const {
 }
 
 Common::SeekableReadStream *QuickTimeDecoder::VideoTrackHandler::getNextFramePacket(uint32 &descId) {
-	// First, we have to track down which chunk holds the sample and which sample in the chunk contains the frame we are looking for.
-	int32 totalSampleCount = 0;
-	int32 sampleInChunk = 0;
-	int32 actualChunk = -1;
-	uint32 sampleToChunkIndex = 0;
-
-	for (uint32 i = 0; i < _parent->chunkCount; i++) {
-		if (sampleToChunkIndex < _parent->sampleToChunkCount && i >= _parent->sampleToChunk[sampleToChunkIndex].first)
-			sampleToChunkIndex++;
-
-		totalSampleCount += _parent->sampleToChunk[sampleToChunkIndex - 1].count;
-
-		if (totalSampleCount > _curFrame) {
-			actualChunk = i;
-			descId = _parent->sampleToChunk[sampleToChunkIndex - 1].id;
-			sampleInChunk = _parent->sampleToChunk[sampleToChunkIndex - 1].count - totalSampleCount + _curFrame;
-			break;
-		}
-	}
+	Common::SeekableReadStream *stream = _decoder->readSample(_parent, _curFrame, descId);
 
-	if (actualChunk < 0)
+	if (!stream)
 		error("Could not find data for frame %d", _curFrame);
 
-	// Next seek to that frame
-	Common::SeekableReadStream *stream = _decoder->_fd;
-	stream->seek(_parent->chunkOffsets[actualChunk]);
-
-	// Then, if the chunk holds more than one frame, seek to where the frame we want is located
-	for (int32 i = _curFrame - sampleInChunk; i < _curFrame; i++) {
-		if (_parent->sampleSize != 0)
-			stream->skip(_parent->sampleSize);
-		else
-			stream->skip(_parent->sampleSizes[i]);
-	}
-
-	// Finally, read in the raw data for the frame
-	//debug("Frame Data[%d]: Offset = %d, Size = %d", _curFrame, stream->pos(), _parent->sampleSizes[_curFrame]);
-
-	if (_parent->sampleSize != 0)
-		return stream->readStream(_parent->sampleSize);
-
-	return stream->readStream(_parent->sampleSizes[_curFrame]);
+	return stream;
 }
 
 uint32 QuickTimeDecoder::VideoTrackHandler::getFrameDuration() {
@@ -633,12 +601,23 @@ uint32 QuickTimeDecoder::VideoTrackHandler::getFrameDuration() {
 }
 
 uint32 QuickTimeDecoder::VideoTrackHandler::findKeyFrame(uint32 frame) const {
-	for (int i = _parent->keyframeCount - 1; i >= 0; i--)
-		if (_parent->keyframes[i] <= frame)
-			return _parent->keyframes[i];
-
 	// If none found, we'll assume the requested frame is a key frame
-	return frame;
+	if (_parent->keyframeCount == 0 || _parent->keyframes[0] > frame)
+		return frame;
+
+	// The keyframe table is sorted, so find the last keyframe at or before
+	// the frame with a binary search
+	uint32 low = 0;
+	uint32 high = _parent->keyframeCount;
+	while (high - low > 1) {
+		uint32 mid = (low + high) / 2;
+		if (_parent->keyframes[mid] <= frame)
+			low = mid;
+		else
+			high = mid;
+	}
+
+	return _parent->keyframes[low];
 }
 
 void QuickTimeDecoder::VideoTrackHandler::enterNewEditList(bool bufferFrames) {
@@ -808,6 +787,21 @@ void QuickTimeDecoder::VideoTrackHandler::setDither(const byte *palette) {
 	}
 }
 
+bool QuickTimeDecoder::VideoTrackHandler::setOutputSurface(Graphics::Surface *surface) {
+	// Scaled and force-dithered frames are converted into surfaces of our
+	// own after decoding, and frames of different sample descriptions come
+	// from different codecs, so only the simple case decodes into the
+	// caller's surface
+	if (_forcedDitherPalette || _parent->scaleFactorX != 1 || _parent->scaleFactorY != 1 || _parent->sampleDescs.size() != 1)
+		return false;
+
+	VideoSampleDesc *desc = (VideoSampleDesc *)_parent->sampleDescs[0];
+	if (!desc || !desc->_videoCodec || surface->w < getWidth() || surface->h < getHeight())
+		return false;
+
+	return desc->_videoCodec->setOutputSurface(surface);
+}
+
 namespace {
 
 // Return a pixel in RGB554
@@ -136,12 +136,14 @@ private:
 		int getFrameCount() const;
 		uint32 getNextFrameStartTime() const;
 		const Graphics::Surface *decodeNextFrame();
+		uint32 getCodecTag() const;
 		const byte *getPalette() const;
 		bool hasDirtyPalette() const { return _curPalette; }
 		bool setReverse(bool reverse);
 		bool isReversed() const { return _reversed; }
 		bool canDither() const;
 		void setDither(const byte *palette);
+		bool setOutputSurface(Graphics::Surface *surface);
 
 		Common::Rational getScaledWidth() const;
 		Common::Rational getScaledHeight() const;
@@ -148,14 +148,24 @@ private:
 		SMK_NODE = 0x80000000
 	};
 
+	enum {
+		/**
+		 * The number of bits resolved by a single lookup in the prefix table.
+		 * Most codes of the video trees are shorter than this, so they are
+		 * decoded without walking the tree at all.
+		 */
+		kPrefixBits = 12,
+		kPrefixSize = 1 << kPrefixBits
+	};
+
 	uint32 decodeTree(uint32 prefix, int length);
 
 	uint32  _treeSize;
 	uint32 *_tree;
 	uint32  _last[3];
 
-	uint32 _prefixtree[256];
-	byte _prefixlength[256];
+	uint32 _prefixtree[kPrefixSize];
+	byte _prefixlength[kPrefixSize];
 
 	/* Used during construction */
 	Common::BitStreamMemory8LSB &_bs;
@@ -174,7 +184,7 @@ BigHuffmanTree::BigHuffmanTree(Common::BitStreamMemory8LSB &bs, int allocSize)
 		return;
 	}
 
-	for (uint32 i = 0; i < 256; ++i)
+	for (uint32 i = 0; i < kPrefixSize; ++i)
 		_prefixtree[i] = _prefixlength[i] = 0;
 
 	_loBytes = new SmallHuffmanTree(_bs);
@@ -222,8 +232,8 @@ uint32 BigHuffmanTree::decodeTree(uint32 prefix, int length) {
 
 		_tree[_treeSize] = v;
 
-		if (length <= 8) {
-			for (int i = 0; i < 256; i += (1 << length)) {
+		if (length <= kPrefixBits) {
+			for (int i = 0; i < kPrefixSize; i += (1 << length)) {
 				_prefixtree[prefix | i] = _treeSize;
 				_prefixlength[prefix | i] = length;
 			}
@@ -242,9 +252,9 @@ uint32 BigHuffmanTree::decodeTree(uint32 prefix, int length) {
 
 	uint32 t = _treeSize++;
 
-	if (length == 8) {
+	if (length == kPrefixBits) {
 		_prefixtree[prefix] = t;
-		_prefixlength[prefix] = 8;
+		_prefixlength[prefix] = kPrefixBits;
 	}
 
 	uint32 r1 = decodeTree(prefix, length + 1);
@@ -256,7 +266,7 @@ uint32 BigHuffmanTree::decodeTree(uint32 prefix, int length) {
 }
 
 uint32 BigHuffmanTree::getCode(Common::BitStreamMemory8LSB &bs) {
-	byte peek = bs.peekBits(MIN<uint32>(bs.size() - bs.pos(), 8));
+	uint32 peek = bs.peekBits(MIN<uint32>(bs.size() - bs.pos(), kPrefixBits));
 	uint32 *p = &_tree[_prefixtree[peek]];
 	bs.skip(_prefixlength[peek]);
 
@@ -520,6 +530,7 @@ VideoDecoder::AudioTrack *SmackerDecoder::getAudioTrack(int index) {
 SmackerDecoder::SmackerVideoTrack::SmackerVideoTrack(uint32 width, uint32 height, uint32 frameCount, const Common::Rational &frameRate, uint32 flags, uint32 signature) {
 	_surface = new Graphics::Surface();
 	_surface->create(width, height * (flags ? 2 : 1), Graphics::PixelFormat::createFormatCLUT8());
+	_hasOutputSurface = false;
 	_frameCount = frameCount;
 	_frameRate = frameRate;
 	_flags = flags;
@@ -531,7 +542,8 @@ SmackerDecoder::SmackerVideoTrack::SmackerVideoTrack(uint32 width, uint32 height
 }
 
 SmackerDecoder::SmackerVideoTrack::~SmackerVideoTrack() {
-	_surface->free();
+	if (!_hasOutputSurface)
+		_surface->free();
 	delete _surface;
 
 	delete _MMapTree;
@@ -540,6 +552,27 @@ SmackerDecoder::SmackerVideoTrack::~SmackerVideoTrack() {
 	delete _TypeTree;
 }
 
+bool SmackerDecoder::SmackerVideoTrack::setOutputSurface(Graphics::Surface *surface) {
+	if (surface->format != _surface->format || surface->w < _surface->w || surface->h < _surface->h)
+		return false;
+
+	// Frames only draw the blocks that changed, so the surface has to start
+	// out with the same contents as our own
+	const byte *src = (const byte *)_surface->getPixels();
+	byte *dst = (byte *)surface->getPixels();
+	for (uint16 y = 0; y < _surface->h; y++, src += _surface->pitch, dst += surface->pitch)
+		memcpy(dst, src, _surface->w);
+
+	const uint16 width = _surface->w;
+	const uint16 height = _surface->h;
+	if (!_hasOutputSurface)
+		_surface->free();
+
+	_surface->init(width, height, surface->pitch, surface->getPixels(), surface->format);
+	_hasOutputSurface = true;
+	return true;
+}
+
 uint16 SmackerDecoder::SmackerVideoTrack::getWidth() const {
 	return _surface->w;
 }
@@ -559,6 +592,17 @@ void SmackerDecoder::SmackerVideoTrack::readTrees(Common::BitStreamMemory8LSB &b
 	_TypeTree = new BigHuffmanTree(bs, typeSize);
 }
 
+/**
+ * Little-endian byte masks selecting the pixels of a mono block row whose bit
+ * in the map nibble is set.
+ */
+static const uint32 kMonoRowMask[16] = {
+	0x00000000, 0x000000ff, 0x0000ff00, 0x0000ffff,
+	0x00ff0000, 0x00ff00ff, 0x00ffff00, 0x00ffffff,
+	0xff000000, 0xff0000ff, 0xff00ff00, 0xff00ffff,
+	0xffff0000, 0xffff00ff, 0xffffff00, 0xffffffff
+};
+
 void SmackerDecoder::SmackerVideoTrack::decodeFrame(Common::BitStreamMemory8LSB &bs) {
 	_MMapTree->reset();
 	_MClrTree->reset();
@@ -570,13 +614,13 @@ void SmackerDecoder::SmackerVideoTrack::decodeFrame(Common::BitStreamMemory8LSB
 
 	uint bw = getWidth() / 4;
 	uint bh = getHeight() / doubleY / 4;
-	uint stride = getWidth();
+	uint stride = _surface->pitch;
 	uint block = 0, blocks = bw*bh;
 
 	byte *out;
 	uint type, run, j, mode;
-	uint32 p1, p2, clr, map;
-	byte hi, lo;
+	uint32 p1, p2, clr, map, row;
+	uint32 hi, lo;
 	uint i;
 
 	while (block < blocks) {
@@ -589,14 +633,14 @@ void SmackerDecoder::SmackerVideoTrack::decodeFrame(Common::BitStreamMemory8LSB
 				clr = _MClrTree->getCode(bs);
 				map = _MMapTree->getCode(bs);
 				out = (byte *)_surface->getPixels() + (block / bw) * (stride * 4 * doubleY) + (block % bw) * 4;
-				hi = clr >> 8;
-				lo = clr & 0xff;
+				// Each nibble of the map selects hi or lo for the four
+				// pixels of a row, so build the whole row at once
+				lo = (clr & 0xff) * 0x01010101;
+				hi = ((clr >> 8) * 0x01010101) ^ lo;
 				for (i = 0; i < 4; i++) {
+					row = lo ^ (hi & kMonoRowMask[map & 0xf]);
 					for (j = 0; j < doubleY; j++) {
-						out[0] = (map & 1) ? hi : lo;
-						out[1] = (map & 2) ? hi : lo;
-						out[2] = (map & 4) ? hi : lo;
-						out[3] = (map & 8) ? hi : lo;
+						WRITE_LE_UINT32(out, row);
 						out += stride;
 					}
 					map >>= 4;
@@ -627,29 +671,25 @@ void SmackerDecoder::SmackerVideoTrack::decodeFrame(Common::BitStreamMemory8LSB
 						for (i = 0; i < 4; ++i) {
 							p1 = _FullTree->getCode(bs);
 							p2 = _FullTree->getCode(bs);
+							row = p2 | (p1 << 16);
 							for (j = 0; j < doubleY; ++j) {
-								out[2] = p1 & 0xff;
-								out[3] = p1 >> 8;
-								out[0] = p2 & 0xff;
-								out[1] = p2 >> 8;
+								WRITE_LE_UINT32(out, row);
 								out += stride;
 							}
 						}
 						break;
 					case 1:
 						p1 = _FullTree->getCode(bs);
-						out[0] = out[1] = p1 & 0xFF;
-						out[2] = out[3] = p1 >> 8;
+						row = ((p1 & 0xff) * 0x0101) | ((p1 >> 8) * 0x01010000);
+						WRITE_LE_UINT32(out, row);
 						out += stride;
-						out[0] = out[1] = p1 & 0xFF;
-						out[2] = out[3] = p1 >> 8;
+						WRITE_LE_UINT32(out, row);
 						out += stride;
 						p2 = _FullTree->getCode(bs);
-						out[0] = out[1] = p2 & 0xFF;
-						out[2] = out[3] = p2 >> 8;
+						row = ((p2 & 0xff) * 0x0101) | ((p2 >> 8) * 0x01010000);
+						WRITE_LE_UINT32(out, row);
 						out += stride;
-						out[0] = out[1] = p2 & 0xFF;
-						out[2] = out[3] = p2 >> 8;
+						WRITE_LE_UINT32(out, row);
 						out += stride;
 						break;
 					case 2:
@@ -659,18 +699,9 @@ void SmackerDecoder::SmackerVideoTrack::decodeFrame(Common::BitStreamMemory8LSB
 							// http://article.gmane.org/gmane.comp.video.ffmpeg.devel/78768
 							p2 = _FullTree->getCode(bs);
 							p1 = _FullTree->getCode(bs);
-							for (j = 0; j < doubleY; ++j) {
-								out[0] = p1 & 0xff;
-								out[1] = p1 >> 8;
-								out[2] = p2 & 0xff;
-								out[3] = p2 >> 8;
-								out += stride;
-							}
-							for (j = 0; j < doubleY; ++j) {
-								out[0] = p1 & 0xff;
-								out[1] = p1 >> 8;
-								out[2] = p2 & 0xff;
-								out[3] = p2 >> 8;
+							row = p1 | (p2 << 16);
+							for (j = 0; j < doubleY * 2; ++j) {
+								WRITE_LE_UINT32(out, row);
 								out += stride;
 							}
 						}
@@ -690,7 +721,7 @@ void SmackerDecoder::SmackerVideoTrack::decodeFrame(Common::BitStreamMemory8LSB
 				out = (byte *)_surface->getPixels() + (block / bw) * (stride * 4 * doubleY) + (block % bw) * 4;
 				col = mode * 0x01010101;
 				for (i = 0; i < 4 * doubleY; ++i) {
-					out[0] = out[1] = out[2] = out[3] = col;
+					WRITE_UINT32(out, col);
 					out += stride;
 				}
 				++block;
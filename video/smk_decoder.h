@@ -88,6 +88,7 @@ protected:
 		int getCurFrame() const { return _curFrame; }
 		int getFrameCount() const { return _frameCount; }
 		const Graphics::Surface *decodeNextFrame() { return _surface; }
+		bool setOutputSurface(Graphics::Surface *surface);
 		const byte *getPalette() const { _dirtyPalette = false; return _palette; }
 		bool hasDirtyPalette() const { return _dirtyPalette; }
 
@@ -100,6 +101,7 @@ protected:
 		Common::Rational getFrameRate() const { return _frameRate; }
 
 		Graphics::Surface *_surface;
+		bool _hasOutputSurface;
 
 	private:
 		Common::Rational _frameRate;
@@ -437,9 +437,13 @@ void TheoraDecoder::queuePage(ogg_page *page) {
 		ogg_stream_pagein(&_vorbisOut, page);
 }
 
+// Large frames span many pages, so reading only a few KB at a time means
+// going through the page loop many times for every frame
+#define OGG_READ_SIZE 65536
+
 int TheoraDecoder::bufferData() {
-	char *buffer = ogg_sync_buffer(&_oggSync, 4096);
-	int bytes = _fileStream->read(buffer, 4096);
+	char *buffer = ogg_sync_buffer(&_oggSync, OGG_READ_SIZE);
+	int bytes = _fileStream->read(buffer, OGG_READ_SIZE);
 
 	ogg_sync_wrote(&_oggSync, bytes);
 
@@ -30,6 +30,7 @@
 #include "common/system.h"
 
 #include "graphics/palette.h"
+#include "graphics/surface.h"
 
 namespace Video {
 
@@ -49,6 +50,9 @@ VideoDecoder::VideoDecoder() {
 	_nextVideoTrack = 0;
 	_mainAudioTrack = 0;
 	_canSetDither = true;
+	_hasOutputSurface = false;
+	_decodeAheadCount = 0;
+	_shownDecodedFrame = 0;
 
 	// Find the best format for output
 	_defaultHighColorFormat = g_system->getScreenFormat();
@@ -61,6 +65,8 @@ void VideoDecoder::close() {
 	if (isPlaying())
 		stop();
 
+	freeDecodedFrames();
+
 	for (TrackList::iterator it = _tracks.begin(); it != _tracks.end(); it++)
 		delete *it;
 
@@ -80,6 +86,7 @@ void VideoDecoder::close() {
 	_nextVideoTrack = 0;
 	_mainAudioTrack = 0;
 	_canSetDither = true;
+	_hasOutputSurface = false;
 }
 
 bool VideoDecoder::loadFile(const Common::String &filename) {
@@ -94,7 +101,7 @@ bool VideoDecoder::loadFile(const Common::String &filename) {
 }
 
 bool VideoDecoder::needsUpdate() const {
-	return hasFramesLeft() && getTimeToNextFrame() == 0;
+	return (!_decodedFrames.empty() || hasFramesLeft()) && getTimeToNextFrame() == 0;
 }
 
 void VideoDecoder::pauseVideo(bool pause) {
@@ -181,10 +188,104 @@ Graphics::PixelFormat VideoDecoder::getPixelFormat() const {
 	return Graphics::PixelFormat();
 }
 
+uint32 VideoDecoder::getVideoCodecTag() const {
+	for (TrackList::const_iterator it = _tracks.begin(); it != _tracks.end(); it++)
+		if ((*it)->getTrackType() == Track::kTrackTypeVideo)
+			return ((VideoTrack *)*it)->getCodecTag();
+
+	return 0;
+}
+
 const Graphics::Surface *VideoDecoder::decodeNextFrame() {
 	_needsUpdate = false;
 	_canSetDither = false;
 
+	if (_shownDecodedFrame) {
+		_freeDecodedFrames.push_back(_shownDecodedFrame);
+		_shownDecodedFrame = 0;
+	}
+
+	if (_decodedFrames.empty()) {
+		const byte *palette;
+		const Graphics::Surface *frame = decodeNextFrameIntern(palette);
+		if (palette) {
+			_palette = palette;
+			_dirtyPalette = true;
+		}
+
+		return frame;
+	}
+
+	// The tracks have already moved past this frame, so only the state
+	// which was saved when it was decoded is restored
+	_shownDecodedFrame = _decodedFrames.front();
+	_decodedFrames.pop_front();
+
+	if (_shownDecodedFrame->hasDirtyPalette) {
+		memcpy(_decodedPalette, _shownDecodedFrame->palette, sizeof(_decodedPalette));
+		_palette = _decodedPalette;
+		_dirtyPalette = true;
+	}
+
+	return _shownDecodedFrame->hasSurface ? _shownDecodedFrame->surface : 0;
+}
+
+bool VideoDecoder::decodeAhead() {
+	if (_decodedFrames.size() >= _decodeAheadCount || !hasFramesLeft())
+		return false;
+
+	// Reversed tracks are repositioned around every decoded frame by some
+	// decoders, so they are only decoded on demand
+	if (!_nextVideoTrack || _nextVideoTrack->isReversed())
+		return false;
+
+	// Decoding into the output surface would overwrite the frame on screen
+	if (_hasOutputSurface)
+		return false;
+
+	_canSetDither = false;
+
+	DecodedFrame *decodedFrame;
+	if (_freeDecodedFrames.empty()) {
+		decodedFrame = new DecodedFrame();
+		decodedFrame->surface = new Graphics::Surface();
+	} else {
+		decodedFrame = _freeDecodedFrames.front();
+		_freeDecodedFrames.pop_front();
+	}
+
+	decodedFrame->startTime = _nextVideoTrack->getNextFrameStartTime();
+	decodedFrame->previousFrame = _decodedFrames.empty() ? getCurFrame() : _decodedFrames.back()->previousFrame + 1;
+
+	// The palette of the track may change again before this frame is shown,
+	// so it is copied too
+	const byte *palette;
+	const Graphics::Surface *frame = decodeNextFrameIntern(palette);
+	decodedFrame->hasDirtyPalette = (palette != 0);
+	if (palette)
+		memcpy(decodedFrame->palette, palette, sizeof(decodedFrame->palette));
+
+	decodedFrame->hasSurface = (frame != 0);
+	if (frame) {
+		Graphics::Surface *surface = decodedFrame->surface;
+
+		// Surfaces are reused for as long as the frame size stays the same
+		if (surface->w != frame->w || surface->h != frame->h || surface->format != frame->format) {
+			surface->free();
+			surface->create(frame->w, frame->h, frame->format);
+		}
+
+		for (int y = 0; y < frame->h; y++)
+			memcpy(surface->getBasePtr(0, y), frame->getBasePtr(0, y), frame->w * frame->format.bytesPerPixel);
+	}
+
+	_decodedFrames.push_back(decodedFrame);
+	return true;
+}
+
+const Graphics::Surface *VideoDecoder::decodeNextFrameIntern(const byte *&palette) {
+	palette = 0;
+
 	readNextPacket();
 
 	// If we have no next video track at this point, there shouldn't be
@@ -194,10 +295,8 @@ const Graphics::Surface *VideoDecoder::decodeNextFrame() {
 
 	const Graphics::Surface *frame = _nextVideoTrack->decodeNextFrame();
 
-	if (_nextVideoTrack->hasDirtyPalette()) {
-		_palette = _nextVideoTrack->getPalette();
-		_dirtyPalette = true;
-	}
+	if (_nextVideoTrack->hasDirtyPalette())
+		palette = _nextVideoTrack->getPalette();
 
 	// Look for the next video track here for the next decode.
 	findNextVideoTrack();
@@ -210,6 +309,11 @@ bool VideoDecoder::setReverse(bool reverse) {
 	if (reverse && hasAudio())
 		return false;
 
+	// The tracks have already moved past any frames decoded ahead, so they
+	// need to go back to the next frame to show before changing direction
+	if (reverse && !_decodedFrames.empty() && !seek(Audio::Timestamp(_decodedFrames.front()->startTime, 1000)))
+		return false;
+
 	// Attempt to make sure all the tracks are in the requested direction
 	for (TrackList::iterator it = _tracks.begin(); it != _tracks.end(); it++) {
 		if ((*it)->getTrackType() == Track::kTrackTypeVideo && ((VideoTrack *)*it)->isReversed() != reverse) {
@@ -224,12 +328,39 @@ bool VideoDecoder::setReverse(bool reverse) {
 	return true;
 }
 
+void VideoDecoder::discardDecodedFrames() {
+	while (!_decodedFrames.empty()) {
+		_freeDecodedFrames.push_back(_decodedFrames.front());
+		_decodedFrames.pop_front();
+	}
+}
+
+void VideoDecoder::freeDecodedFrames() {
+	discardDecodedFrames();
+
+	if (_shownDecodedFrame) {
+		_freeDecodedFrames.push_back(_shownDecodedFrame);
+		_shownDecodedFrame = 0;
+	}
+
+	for (DecodedFrameList::iterator it = _freeDecodedFrames.begin(); it != _freeDecodedFrames.end(); it++) {
+		(*it)->surface->free();
+		delete (*it)->surface;
+		delete *it;
+	}
+
+	_freeDecodedFrames.clear();
+}
+
 const byte *VideoDecoder::getPalette() {
 	_dirtyPalette = false;
 	return _palette;
 }
 
 int VideoDecoder::getCurFrame() const {
+	if (!_decodedFrames.empty())
+		return _decodedFrames.front()->previousFrame;
+
 	int32 frame = -1;
 
 	for (TrackList::const_iterator it = _tracks.begin(); it != _tracks.end(); it++)
@@ -271,13 +402,22 @@ uint32 VideoDecoder::getTime() const {
 }
 
 uint32 VideoDecoder::getTimeToNextFrame() const {
-	if (endOfVideo() || _needsUpdate || !_nextVideoTrack)
+	if (endOfVideo() || _needsUpdate)
 		return 0;
 
 	uint32 currentTime = getTime();
-	uint32 nextFrameStartTime = _nextVideoTrack->getNextFrameStartTime();
+	uint32 nextFrameStartTime;
+
+	// Frames are never decoded ahead in reverse
+	if (!_decodedFrames.empty()) {
+		nextFrameStartTime = _decodedFrames.front()->startTime;
+	} else if (!_nextVideoTrack) {
+		return 0;
+	} else {
+		nextFrameStartTime = _nextVideoTrack->getNextFrameStartTime();
+	}
 
-	if (_nextVideoTrack->isReversed()) {
+	if (_decodedFrames.empty() && _nextVideoTrack->isReversed()) {
 		// For reversed videos, we need to handle the time difference the opposite way.
 		if (nextFrameStartTime >= currentTime)
 			return 0;
@@ -293,6 +433,9 @@ uint32 VideoDecoder::getTimeToNextFrame() const {
 }
 
 bool VideoDecoder::endOfVideo() const {
+	if (!_decodedFrames.empty())
+		return false;
+
 	for (TrackList::const_iterator it = _tracks.begin(); it != _tracks.end(); it++) {
 		const Track *track = *it;
 
@@ -324,6 +467,8 @@ bool VideoDecoder::rewind() {
 	if (isPlaying())
 		stopAudio();
 
+	discardDecodedFrames();
+
 	for (TrackList::iterator it = _tracks.begin(); it != _tracks.end(); it++)
 		if (!(*it)->rewind())
 			return false;
@@ -359,6 +504,7 @@ bool VideoDecoder::seek(const Audio::Timestamp &time) {
 		stopAudio();
 
 	// Do the actual seeking
+	discardDecodedFrames();
 	if (!seekIntern(time))
 		return false;
 
@@ -523,6 +669,28 @@ bool VideoDecoder::setDitheringPalette(const byte *palette) {
 	return result;
 }
 
+bool VideoDecoder::setOutputSurface(Graphics::Surface *surface) {
+	// If a frame was already decoded, we can't set it now.
+	if (!_canSetDither)
+		return false;
+
+	bool result = false;
+	bool allTracks = true;
+
+	for (TrackList::iterator it = _tracks.begin(); it != _tracks.end(); it++) {
+		if ((*it)->getTrackType() == Track::kTrackTypeVideo) {
+			if (((VideoTrack *)*it)->setOutputSurface(surface)) {
+				_hasOutputSurface = true;
+				result = true;
+			} else {
+				allTracks = false;
+			}
+		}
+	}
+
+	return result && allTracks;
+}
+
 VideoDecoder::Track::Track() {
 	_paused = false;
 }
@@ -808,6 +976,12 @@ void VideoDecoder::setEndTime(const Audio::Timestamp &endTime) {
 	_endTime = endTime;
 	_endTimeSet = true;
 
+	// Frames decoded ahead past the new end time must not be shown
+	while (!_decodedFrames.empty() && _decodedFrames.back()->startTime >= (uint32)_endTime.msecs()) {
+		_freeDecodedFrames.push_back(_decodedFrames.back());
+		_decodedFrames.pop_back();
+	}
+
 	if (startTime > endTime)
 		return;
 
@@ -939,6 +1113,8 @@ bool VideoDecoder::hasAudio() const {
 }
 
 void VideoDecoder::eraseTrack(Track *track) {
+	discardDecodedFrames();
+
 	for (uint idx = 0; idx < _externalTracks.size(); ++idx) {
 		if (_externalTracks[idx] == track)
 			_externalTracks.remove_at(idx);
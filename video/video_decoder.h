@@ -26,6 +26,7 @@
 #include "audio/mixer.h"
 #include "audio/timestamp.h"	// TODO: Move this to common/ ?
 #include "common/array.h"
+#include "common/list.h"
 #include "common/rational.h"
 #include "common/str.h"
 #include "graphics/pixelformat.h"
@@ -52,7 +53,7 @@ namespace Video {
 class VideoDecoder {
 public:
 	VideoDecoder();
-	virtual ~VideoDecoder() {}
+	virtual ~VideoDecoder() { freeDecodedFrames(); }
 
 	/////////////////////////////////////////
 	// Opening/Closing a Video
@@ -300,6 +301,12 @@ public:
 	 */
 	Graphics::PixelFormat getPixelFormat() const;
 
+	/**
+	 * Get the tag of the codec used by the first video track, or 0 if it is
+	 * unknown or the container format only has a single codec.
+	 */
+	uint32 getVideoCodecTag() const;
+
 	/**
 	 * Get the duration of the video.
 	 *
@@ -355,6 +362,33 @@ public:
 	 */
 	virtual const Graphics::Surface *decodeNextFrame();
 
+	/**
+	 * Set how many frames decodeAhead() may decode before they are due.
+	 *
+	 * Decoding ahead is disabled by default. Frames which have already been
+	 * decoded ahead are still returned when the count is lowered.
+	 *
+	 * @param count The maximum number of frames to decode ahead, or 0
+	 */
+	void setDecodeAheadCount(uint count) { _decodeAheadCount = count; }
+
+	/**
+	 * Decode the next frame before it is due, if decoding ahead is enabled
+	 * and fewer than the decode ahead count of frames are waiting.
+	 *
+	 * The frame and its palette are copied into a queue, and a later call to
+	 * decodeNextFrame() returns them without decoding anything. Calling this
+	 * while waiting for the current frame to expire spreads the cost of
+	 * expensive frames, such as key frames, over otherwise idle time so
+	 * they do not miss their display time.
+	 *
+	 * Seeking, rewinding and reversing discard any frames decoded ahead.
+	 * Videos playing in reverse are never decoded ahead.
+	 *
+	 * @return true if a frame was decoded, false otherwise
+	 */
+	bool decodeAhead();
+
 	/**
 	 * Set the default high color format for videos that convert from YUV.
 	 *
@@ -396,6 +430,35 @@ public:
 	 */
 	bool setDitheringPalette(const byte *palette);
 
+	/**
+	 * Tell the video to decode frames directly into a surface owned by the
+	 * caller.
+	 *
+	 * By default, VideoDecoder decodes every frame into a surface of its own,
+	 * which the caller then has to copy to wherever it is displayed. Video
+	 * formats that support it will instead decode into the given surface,
+	 * which saves copying every frame.
+	 *
+	 * The surface must use the pixel format of the video (so this must be
+	 * called after setDitheringPalette(), if that is used) and be at least as
+	 * large as the video. Frames are drawn at the top-left corner of the
+	 * surface. Since most formats only update the parts of a frame which
+	 * changed, the surface must stay valid and must not be modified by the
+	 * caller until the video is closed.
+	 *
+	 * decodeNextFrame() still returns the frame. Its pixels are those of the
+	 * given surface when the frame was decoded into it, in which case it does
+	 * not need to be copied. Decoding ahead is disabled when frames are
+	 * decoded into the surface.
+	 *
+	 * This should be called after loadStream(), but before a decodeNextFrame()
+	 * call. This is enforced.
+	 *
+	 * @param surface The surface to decode into
+	 * @return true if every video track will decode into the surface, false otherwise
+	 */
+	bool setOutputSurface(Graphics::Surface *surface);
+
 	/////////////////////////////////////////
 	// Audio Control
 	/////////////////////////////////////////
@@ -603,6 +666,12 @@ protected:
 		 */
 		virtual const Graphics::Surface *decodeNextFrame() = 0;
 
+		/**
+		 * Get the tag of the codec this track is encoded with, or 0 if the
+		 * container format has no codec tags
+		 */
+		virtual uint32 getCodecTag() const { return 0; }
+
 		/**
 		 * Get the palette currently in use by this track
 		 */
@@ -645,6 +714,14 @@ protected:
 		 * Activate dithering mode with a palette
 		 */
 		virtual void setDither(const byte *palette) {}
+
+		/**
+		 * Decode frames into the given surface instead of the track's own.
+		 *
+		 * @see VideoDecoder::setOutputSurface()
+		 * @return true if the track will decode into the surface, false otherwise
+		 */
+		virtual bool setOutputSurface(Graphics::Surface *surface) { return false; }
 	};
 
 	/**
@@ -943,13 +1020,40 @@ private:
 	mutable bool _dirtyPalette;
 	const byte *_palette;
 
-	// Enforcement of not being able to set dither
+	// Enforcement of not being able to set dither or the output surface
 	bool _canSetDither;
 
+	// Whether frames are decoded into a surface owned by the caller
+	bool _hasOutputSurface;
+
 	// Default PixelFormat settings
 	Graphics::PixelFormat _defaultHighColorFormat;
 
+	/**
+	 * A frame which was decoded before it was due.
+	 */
+	struct DecodedFrame {
+		Graphics::Surface *surface;
+		bool hasSurface;
+		bool hasDirtyPalette;
+		byte palette[3 * 256];
+		uint32 startTime;
+		int previousFrame;
+	};
+
+	typedef Common::List<DecodedFrame *> DecodedFrameList;
+
+	// Decode ahead state
+	uint _decodeAheadCount;
+	DecodedFrameList _decodedFrames;
+	DecodedFrameList _freeDecodedFrames;
+	DecodedFrame *_shownDecodedFrame;
+	byte _decodedPalette[3 * 256];
+
 	// Internal helper functions
+	const Graphics::Surface *decodeNextFrameIntern(const byte *&palette);
+	void discardDecodedFrames();
+	void freeDecodedFrames();
 	void stopAudio();
 	void startAudio();
 	void startAudioLimit(const Audio::Timestamp &limit);